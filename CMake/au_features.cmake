@@ -1,5 +1,5 @@
 #
-# Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+# Copyright (C) 2025-2026, Advanced Micro Devices. All rights reserved.
 #
 # Redistribution and use in source and binary forms, with or without
 # modification, are permitted provided that the following conditions are met:
@@ -47,6 +47,7 @@ set(au_cpuid_FEATURES
 
 # Define feature dependencies
 set(Logger_DEPENDS "Status")
+set(ThreadPinning_DEPENDS "Status")
 
 # Define target names for modules
 set(au_cpuid_TARGET_NAME "au_cpuid")
@@ -1,5 +1,5 @@
 #
-# Copyright (C) 2022-2024, Advanced Micro Devices. All rights reserved.
+# Copyright (C) 2022-2026, Advanced Micro Devices. All rights reserved.
 #
 # Redistribution and use in source and binary forms, with or without
 # modification, are permitted provided that the following conditions are met:
@@ -41,6 +41,7 @@ option(AU_ENABLE_CODE_COVERAGE "Enable Code coverage on build" OFF)
 option(AU_BUILD_STATIC_LIBS "Build static libraries" ON)
 option(AU_BUILD_SHARED_LIBS "Build shared libraries" ON)
 option(AU_CMAKE_VERBOSE "Set cmake verbosity" OFF)
+option(AU_ENABLE_TRACE "Compile AU_TRACE_SCOPE spans in" ON)
 
 # Sub options for docs
 # Doxygen generate graphs and enable code browsing
@@ -77,6 +78,27 @@ mark_as_advanced(AU_BUILD_TYPE_RELEASE
     AU_ENABLE_ASSERTIONS
     AU_WARN_DEPRECATION)
 
+# Lowest logger priority compiled into the AU_LOGGER_LOG* macros, calls below
+# it compile to nothing.
+set(AU_LOGGER_MIN_LEVEL "TRACE" CACHE STRING
+    "Lowest log level compiled in (FATAL PANIC ERROR WARNING NOTICE INFO DEBUG TRACE)")
+set(AU_LOGGER_LEVELS FATAL PANIC ERROR WARNING NOTICE INFO DEBUG TRACE)
+set_property(CACHE AU_LOGGER_MIN_LEVEL PROPERTY STRINGS ${AU_LOGGER_LEVELS})
+string(TOUPPER "${AU_LOGGER_MIN_LEVEL}" upper_AU_LOGGER_MIN_LEVEL)
+list(FIND AU_LOGGER_LEVELS "${upper_AU_LOGGER_MIN_LEVEL}" __level_index)
+if (__level_index EQUAL -1)
+  message(FATAL_ERROR "Invalid value for AU_LOGGER_MIN_LEVEL: ${AU_LOGGER_MIN_LEVEL}")
+endif()
+# Same encoding as Au::Logger::Priority::PriorityLevel
+math(EXPR AU_LOGGER_MIN_LEVEL_VALUE "1 << ${__level_index}")
+
+# AU_TRACE_SCOPE expands to nothing when tracing is compiled out
+if (AU_ENABLE_TRACE)
+  set(AU_TRACE_ENABLED_VALUE 1)
+else()
+  set(AU_TRACE_ENABLED_VALUE 0)
+endif()
+
 if (AU_CMAKE_VERBOSE AND FALSE)
 message(
 	"build type \n"
@@ -84,7 +106,8 @@ message(
 	"debug:" ${AU_BUILD_TYPE_DEBUG} "\n"
 	"developer:" ${AU_BUILD_TYPE_DEVELOPER} "\n"
     "relwithdebinfo:" ${AU_BUILD_TYPE_RELWITHDEBINFO} "\n"
-	"assertions: " ${AU_ENABLE_ASSERTIONS})
+	"assertions: " ${AU_ENABLE_ASSERTIONS} "\n"
+	"logger min level: " ${AU_LOGGER_MIN_LEVEL})
 endif()
 
 
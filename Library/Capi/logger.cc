@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -27,77 +27,200 @@
  */
 
 #include "Capi/au/logger/logger.h"
-#include "Au/Logger/LogManager.hh"
+#include "Au/Logger/Format.hh"
 #include "Au/Logger/LoggerCtx.hh"
 
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+using Au::Logger::FormatRegistry;
+using Au::Logger::LogWriter;
+using Au::Logger::Message;
+using Au::Logger::MessageBuffer;
+using Au::Logger::Priority;
+
+namespace {
+// Indexed by log_level_t
+constexpr Priority::PriorityLevel cPriorityLevels[] = {
+    Priority::PriorityLevel::eTrace,   Priority::PriorityLevel::eDebug,
+    Priority::PriorityLevel::eInfo,    Priority::PriorityLevel::eWarning,
+    Priority::PriorityLevel::eError,   Priority::PriorityLevel::eFatal,
+};
+
+// Format ids remembered per thread, keyed by the format pointer
+constexpr size_t cFormatCacheSize = 64;
+
+struct FormatCacheEntry
+{
+    const char* format; ///< Pointer passed by the caller
+    const char* text;   ///< Registered copy, compared against format
+    Au::Uint32  id;
+};
+
+// Contexts alive, the last one destroyed flushes the writer
+std::atomic<Au::Uint64> liveContexts{ 0 };
+
+Priority::PriorityLevel
+toPriorityLevel(log_level_t level)
+{
+    auto index = static_cast<size_t>(level);
+    return index < std::size(cPriorityLevels)
+               ? cPriorityLevels[index]
+               : Priority::PriorityLevel::eInfo;
+}
+
+Au::Uint32
+getFormatId(const char* format)
+{
+    thread_local FormatCacheEntry cache[cFormatCacheSize] = {};
+
+    auto& entry = cache[(reinterpret_cast<std::uintptr_t>(format) >> 4)
+                        % cFormatCacheSize];
+    // The text is compared too, the caller may reuse a buffer
+    if (entry.format == format && std::strcmp(entry.text, format) == 0) {
+        return entry.id;
+    }
+    FormatRegistry& registry = FormatRegistry::get();
+    Au::Uint32      id       = registry.internFormat(format);
+    if (id != FormatRegistry::cNoFormatId) {
+        entry = FormatCacheEntry{ format, registry.getFormat(id).c_str(), id };
+    }
+    return id;
+}
+
+/**
+ * @brief Formats on the calling thread, for formats the registry no longer
+ * takes.
+ */
+Au::String
+formatNow(const char* format, va_list args)
+{
+    va_list sizing;
+    va_copy(sizing, args);
+    int len = std::vsnprintf(nullptr, 0, format, sizing);
+    va_end(sizing);
+    if (len <= 0) {
+        return Au::String();
+    }
+    Au::String text(static_cast<size_t>(len), '\0');
+    std::vsnprintf(&text[0], text.size() + 1, format, args);
+    return text;
+}
+
+/**
+ * @brief Queues msg on the running writer, which all contexts and the NULL
+ * context share.
+ */
+void
+submit(Message&& msg)
+{
+    LogWriter::current().log(std::move(msg));
+}
+} // namespace
+
 AUD_EXTERN_C_BEGIN
 
 logger_ctx_t*
 au_logger_create()
 {
+    // Starts the logging thread
+    LogWriter::current();
     LoggerCtx* loggerCtx = new LoggerCtx();
-    // Check if memory allocation is successful
-    if (loggerCtx == nullptr) {
-        return nullptr;
-    }
+    liveContexts.fetch_add(1, std::memory_order_relaxed);
+    return loggerCtx;
+}
 
-    loggerCtx->logger = std::make_unique<Au::Logger::LogManager>(
-        Au::Logger::LogWriter::getLogWriter());
-    // Check if memory allocation is successful
-    if (loggerCtx->logger == nullptr) {
-        delete loggerCtx;
-        return nullptr;
+void
+au_logger_log(logger_ctx_t* /* logger */,
+              const char*   message,
+              log_level_t   level)
+{
+    Priority::PriorityLevel priorityLevel = toPriorityLevel(level);
+    if (!LogWriter::isLevelEnabled(priorityLevel) || message == nullptr) {
+        return;
     }
+    submit(Message(message, Priority(priorityLevel)));
+}
 
-    return loggerCtx;
+void
+au_logger_vlogf(logger_ctx_t* /* logger */,
+                log_level_t   level,
+                const char*   format,
+                va_list       args)
+{
+    Priority::PriorityLevel priorityLevel = toPriorityLevel(level);
+    if (!LogWriter::isLevelEnabled(priorityLevel) || format == nullptr) {
+        return;
+    }
+    Au::Uint32 id = getFormatId(format);
+    if (id == FormatRegistry::cNoFormatId) {
+        submit(Message(formatNow(format, args), Priority(priorityLevel)));
+        return;
+    }
+    MessageBuffer buf;
+    Au::Logger::encodeVarArgs(buf, format, args);
+    submit(
+        Message::deferredEncoded(id, Priority(priorityLevel), std::move(buf)));
 }
 
 void
-au_logger_log(logger_ctx_t* logger, const char* message, log_level_t level)
+au_logger_logf(logger_ctx_t* logger,
+               log_level_t   level,
+               const char*   format,
+               ...)
 {
-    LoggerCtx* loggerCtx = reinterpret_cast<LoggerCtx*>(logger);
-    Au::Logger::Priority::PriorityLevel priority;
-    switch (level) {
-        case AUD_LOG_LEVEL_TRACE:
-            priority = Au::Logger::Priority::PriorityLevel::eTrace;
-            break;
-        case AUD_LOG_LEVEL_DEBUG:
-            priority = Au::Logger::Priority::PriorityLevel::eDebug;
-            break;
-        case AUD_LOG_LEVEL_INFO:
-            priority = Au::Logger::Priority::PriorityLevel::eInfo;
-            break;
-        case AUD_LOG_LEVEL_WARN:
-            priority = Au::Logger::Priority::PriorityLevel::eWarning;
-            break;
-        case AUD_LOG_LEVEL_ERROR:
-            priority = Au::Logger::Priority::PriorityLevel::eError;
-            break;
-        case AUD_LOG_LEVEL_FATAL:
-            priority = Au::Logger::Priority::PriorityLevel::eFatal;
-            break;
-        default:
-            priority = Au::Logger::Priority::PriorityLevel::eInfo;
-            break;
+    // Before va_start, a filtered call does no other work
+    if (!LogWriter::isLevelEnabled(toPriorityLevel(level))) {
+        return;
     }
-    Au::Logger::Priority p(priority);
-    Au::Logger::Message  msg(message, p);
-    loggerCtx->logger->log(msg);
+    va_list args;
+    va_start(args, format);
+    au_logger_vlogf(logger, level, format, args);
+    va_end(args);
 }
 
 void
-au_logger_flush(logger_ctx_t* logger)
+au_logger_flush(logger_ctx_t* /* logger */)
 {
-    LoggerCtx* loggerCtx = reinterpret_cast<LoggerCtx*>(logger);
-    loggerCtx->logger->flush();
+    LogWriter::current().flush();
 }
 
 void
 au_logger_destroy(logger_ctx_t* logger)
 {
     LoggerCtx* loggerCtx = reinterpret_cast<LoggerCtx*>(logger);
-    Au::Logger::LogWriter::getLogWriter()->stop();
+    if (loggerCtx == nullptr) {
+        return;
+    }
+    // Other contexts keep logging, the writer only stops at process exit
+    if (liveContexts.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        LogWriter::current().flush();
+    }
     delete loggerCtx;
 }
 
+void
+au_logger_get_stats(au_logger_stats_t* stats)
+{
+    if (stats == nullptr) {
+        return;
+    }
+    Au::Logger::LogWriterStats counters = Au::Logger::LogWriter::getStats();
+
+    stats->messages_written       = counters.messagesWritten;
+    stats->messages_dropped       = counters.messagesDropped;
+    stats->bytes_written          = counters.bytesWritten;
+    stats->queue_depth            = counters.queueDepth;
+    stats->max_queue_depth        = counters.maxQueueDepth;
+    stats->enqueue_samples        = counters.enqueueSamples;
+    stats->enqueue_latency_avg_ns = counters.enqueueLatencyAvgNs;
+    stats->enqueue_latency_max_ns = counters.enqueueLatencyMaxNs;
+    stats->writer_busy_ns         = counters.writerBusyNs;
+    stats->writer_run_ns          = counters.writerRunNs;
+    stats->writer_utilization     = counters.writerUtilization;
+}
+
 AUD_EXTERN_C_END
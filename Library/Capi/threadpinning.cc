@@ -22,6 +22,8 @@
 
 #include "Au/ThreadPinning.hh"
 #include "Au/Assert.hh"
+#include "Au/Error.hh"
+#include "Capi/au/error.h"
 #include "Capi/au/macros.h"
 #include "Capi/au/threadpinning.h"
 #include <vector>
@@ -30,53 +32,157 @@ AUD_EXTERN_C_BEGIN
 
 using namespace Au;
 
+static au_error_t
+toError(const Status& status)
+{
+    if (status.ok())
+        return (au_error_t)eError_Ok;
+    if (status.code() == InvalidArgumentError().code())
+        return (au_error_t)eError_InvalidArgument;
+    return (au_error_t)eError_Generic;
+}
+
 AUD_API_EXPORT
 void
+au_topology_init(void)
+{
+    ThreadPinning::initTopology();
+}
+
+AUD_API_EXPORT
+au_error_t
 au_pin_threads_core(pthread_t* threadList, size_t threadListSize)
 {
     AUD_ASSERT(threadList != nullptr, "Thread list is null");
     AUD_ASSERT(threadListSize > 0, "Thread list size is 0");
+    AUD_BAD_PTR_ERR_RET(threadList, eError_BadPointer);
 
     ThreadPinning          tp;
     std::vector<pthread_t> threadListVec;
     for (size_t i = 0; i < threadListSize; i++) {
         threadListVec.push_back(threadList[i]);
     }
-    tp.pinThreads(threadListVec, 1); // core
+    return toError(tp.pinThreads(threadListVec, 1)); // core
 }
 
 AUD_API_EXPORT
-void
+au_error_t
 au_pin_threads_logical(pthread_t* threadList, size_t threadListSize)
 {
     AUD_ASSERT(threadList != nullptr, "Thread list is null");
     AUD_ASSERT(threadListSize > 0, "Thread list size is 0");
+    AUD_BAD_PTR_ERR_RET(threadList, eError_BadPointer);
 
     ThreadPinning          tp;
     std::vector<pthread_t> threadListVec;
     for (size_t i = 0; i < threadListSize; i++) {
         threadListVec.push_back(threadList[i]);
     }
-    tp.pinThreads(threadListVec, 2); // logical
+    return toError(tp.pinThreads(threadListVec, 2)); // logical
 }
 
 AUD_API_EXPORT
-void
+au_error_t
 au_pin_threads_spread(pthread_t* threadList, size_t threadListSize)
 {
     AUD_ASSERT(threadList != nullptr, "Thread list is null");
     AUD_ASSERT(threadListSize > 0, "Thread list size is 0");
+    AUD_BAD_PTR_ERR_RET(threadList, eError_BadPointer);
 
     ThreadPinning          tp;
     std::vector<pthread_t> threadListVec;
     for (size_t i = 0; i < threadListSize; i++) {
         threadListVec.push_back(threadList[i]);
     }
-    tp.pinThreads(threadListVec, 0); // spread
+    return toError(tp.pinThreads(threadListVec, 0)); // spread
+}
+
+static au_error_t
+pinThreadsNuma(pthread_t* threadList,
+               size_t     threadListSize,
+               int*       numaNodes,
+               int        pinStrategyIndex)
+{
+    AUD_ASSERT(threadList != nullptr, "Thread list is null");
+    AUD_ASSERT(threadListSize > 0, "Thread list size is 0");
+    AUD_BAD_PTR_ERR_RET(threadList, eError_BadPointer);
+
+    ThreadPinning          tp;
+    std::vector<pthread_t> threadListVec;
+    for (size_t i = 0; i < threadListSize; i++) {
+        threadListVec.push_back(threadList[i]);
+    }
+    std::vector<int> numaNodesVec;
+    Status           status =
+        tp.pinThreads(threadListVec, pinStrategyIndex, numaNodesVec);
+    if (numaNodes != nullptr) {
+        for (size_t i = 0; i < threadListSize; i++) {
+            numaNodes[i] = i < numaNodesVec.size() ? numaNodesVec[i] : -1;
+        }
+    }
+    return toError(status);
 }
 
 AUD_API_EXPORT
-void
+au_error_t
+au_pin_threads_numa_compact(pthread_t* threadList,
+                            size_t     threadListSize,
+                            int*       numaNodes)
+{
+    // numa compact
+    return pinThreadsNuma(threadList, threadListSize, numaNodes, 3);
+}
+
+AUD_API_EXPORT
+au_error_t
+au_pin_threads_numa_spread(pthread_t* threadList,
+                           size_t     threadListSize,
+                           int*       numaNodes)
+{
+    // numa spread
+    return pinThreadsNuma(threadList, threadListSize, numaNodes, 4);
+}
+
+AUD_API_EXPORT
+au_error_t
+au_pin_threads_cache_spread(pthread_t* threadList,
+                            size_t     threadListSize,
+                            int        cacheLevel)
+{
+    AUD_ASSERT(threadList != nullptr, "Thread list is null");
+    AUD_ASSERT(threadListSize > 0, "Thread list size is 0");
+    AUD_BAD_PTR_ERR_RET(threadList, eError_BadPointer);
+
+    ThreadPinning          tp;
+    std::vector<pthread_t> threadListVec;
+    for (size_t i = 0; i < threadListSize; i++) {
+        threadListVec.push_back(threadList[i]);
+    }
+    // spread
+    return toError(tp.pinThreads(threadListVec, 0, cacheLevel));
+}
+
+AUD_API_EXPORT
+au_error_t
+au_pin_threads_cache_compact(pthread_t* threadList,
+                             size_t     threadListSize,
+                             int        cacheLevel)
+{
+    AUD_ASSERT(threadList != nullptr, "Thread list is null");
+    AUD_ASSERT(threadListSize > 0, "Thread list size is 0");
+    AUD_BAD_PTR_ERR_RET(threadList, eError_BadPointer);
+
+    ThreadPinning          tp;
+    std::vector<pthread_t> threadListVec;
+    for (size_t i = 0; i < threadListSize; i++) {
+        threadListVec.push_back(threadList[i]);
+    }
+    // cache compact
+    return toError(tp.pinThreads(threadListVec, 5, cacheLevel));
+}
+
+AUD_API_EXPORT
+au_error_t
 au_pin_threads_custom(pthread_t* threadList,
                       size_t     threadListSize,
                       int*       affinityVector,
@@ -84,10 +190,12 @@ au_pin_threads_custom(pthread_t* threadList,
 {
     AUD_ASSERT(threadList != nullptr, "Thread list is null");
     AUD_ASSERT(threadListSize > 0, "Thread list size is 0");
+    AUD_BAD_PTR_ERR_RET(threadList, eError_BadPointer);
     AUD_ASSERT(affinityVector != nullptr, "Affinity vector is null");
     AUD_ASSERT(affinityVectorSize > 0, "Affinity vector size is 0");
     AUD_ASSERT(affinityVectorSize == threadListSize,
                "Affinity vector size is not equal to thread list size");
+    AUD_BAD_PTR_ERR_RET(affinityVector, eError_BadPointer);
 
     ThreadPinning          tp;
     std::vector<pthread_t> threadListVec;
@@ -99,6 +207,6 @@ au_pin_threads_custom(pthread_t* threadList,
     for (size_t i = 0; i < affinityVectorSize; i++) {
         affinityVectorVec.push_back(affinityVector[i]);
     }
-    tp.pinThreads(threadListVec, affinityVectorVec);
+    return toError(tp.pinThreads(threadListVec, affinityVectorVec));
 }
 AUD_EXTERN_C_END
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Logger/Logger.hh"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace Au::Logger {
+
+namespace {
+    template<typename T>
+    void appendValue(String& buf, T value)
+    {
+        buf.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    template<typename T>
+    bool readValue(const String& data, size_t& pos, T& value)
+    {
+        if (pos + sizeof(T) > data.size()) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool readBytes(const String& data, size_t& pos, String& bytes)
+    {
+        Uint32 size = 0;
+        if (!readValue(data, pos, size) || pos + size > data.size()) {
+            return false;
+        }
+        bytes.assign(data.data() + pos, size);
+        pos += size;
+        return true;
+    }
+
+    bool hasMagic(const String& data, size_t pos)
+    {
+        constexpr size_t cMagicSize = sizeof(BinaryFileLogger::cMagic);
+        return pos + cMagicSize <= data.size()
+               && std::memcmp(
+                      data.data() + pos, BinaryFileLogger::cMagic, cMagicSize)
+                      == 0;
+    }
+} // namespace
+
+// Class BinaryFileLogger begins
+BinaryFileLogger::BinaryFileLogger(const String& filename)
+    : FileLogger(filename, "ab")
+    , m_formatWritten{}
+{
+    // Every session starts with the magic, format ids are per process
+    m_buffer.assign(cMagic, sizeof(cMagic));
+    if (m_file != nullptr) {
+        writeBuffer();
+    }
+}
+
+void
+BinaryFileLogger::appendRecord(const Message& msg)
+{
+    Uint32 formatId = msg.isDeferred() ? msg.getFormatId()
+                                       : FormatRegistry::cPlainTextId;
+
+    if (formatId >= m_formatWritten.size()) {
+        m_formatWritten.resize(formatId + 1, false);
+    }
+    if (!m_formatWritten[formatId]) {
+        const String& format = FormatRegistry::get().getFormat(formatId);
+        m_buffer += 'F';
+        appendValue(m_buffer, formatId);
+        appendValue(m_buffer, static_cast<Uint32>(format.size()));
+        m_buffer += format;
+        m_formatWritten[formatId] = true;
+    }
+
+    m_buffer += 'M';
+    appendValue(m_buffer, formatId);
+    appendValue(m_buffer, static_cast<Uint32>(msg.getPriority().getLevel()));
+    appendValue(m_buffer, msg.getTimestamp().getNanosecond());
+    if (msg.isDeferred()) {
+        StringView args = msg.getPayload();
+        appendValue(m_buffer, static_cast<Uint32>(args.size()));
+        m_buffer += args;
+    } else {
+        String args = encodeArgs(msg.getPayload());
+        appendValue(m_buffer, static_cast<Uint32>(args.size()));
+        m_buffer += args;
+    }
+
+    if (msg.hasFields()) {
+        StringView fields = msg.getEncodedFields();
+        m_buffer += 'K';
+        appendValue(m_buffer, static_cast<Uint32>(fields.size()));
+        m_buffer += fields;
+    }
+}
+
+void
+BinaryFileLogger::write(const Message& msg)
+{
+    if (m_file == nullptr) {
+        return;
+    }
+    m_buffer.clear();
+    appendRecord(msg);
+    writeBuffer();
+}
+
+void
+BinaryFileLogger::writeBatch(const std::vector<Message>& msgs)
+{
+    if (m_file == nullptr) {
+        return;
+    }
+    m_buffer.clear();
+    for (const auto& msg : msgs) {
+        appendRecord(msg);
+    }
+    writeBuffer();
+}
+
+String
+BinaryFileLogger::getLoggerType() const
+{
+    return "BinaryFileLogger";
+}
+// Class BinaryFileLogger ends
+
+// Class BinaryLogDecoder begins
+bool
+BinaryLogDecoder::decode(const String& data, std::vector<Message>& msgs)
+{
+    if (!hasMagic(data, 0)) {
+        return false;
+    }
+
+    std::vector<String> formats;
+    size_t              pos = 0;
+    while (pos < data.size()) {
+        if (hasMagic(data, pos)) {
+            // New session, its format ids are unrelated to the previous one
+            formats.clear();
+            pos += sizeof(BinaryFileLogger::cMagic);
+            continue;
+        }
+
+        char   kind     = data[pos++];
+        Uint32 formatId = 0;
+        if (kind == 'K') {
+            String fields;
+            if (msgs.empty() || !readBytes(data, pos, fields)) {
+                return false;
+            }
+            msgs.back().addEncodedFields(fields);
+            continue;
+        }
+        if (!readValue(data, pos, formatId)) {
+            return false;
+        }
+
+        if (kind == 'F') {
+            String format;
+            if (!readBytes(data, pos, format)) {
+                return false;
+            }
+            if (formatId >= formats.size()) {
+                formats.resize(formatId + 1);
+            }
+            formats[formatId] = std::move(format);
+        } else if (kind == 'M') {
+            Uint32 level       = 0;
+            Uint64 nanoseconds = 0;
+            String args;
+            if (!readValue(data, pos, level) || !readValue(data, pos, nanoseconds)
+                || !readBytes(data, pos, args)) {
+                return false;
+            }
+            bool knownLevel = level != 0 && level <= (1u << 7)
+                              && (level & (level - 1)) == 0;
+            if (!knownLevel) {
+                level = static_cast<Uint32>(Priority::PriorityLevel::eInfo);
+            }
+            String   format = formatId < formats.size() ? formats[formatId] : "";
+            Priority priority(static_cast<Priority::PriorityLevel>(level));
+            msgs.emplace_back(
+                formatDeferred(format, args), priority, Timestamp(nanoseconds));
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+BinaryLogDecoder::decodeFile(const String& filename, std::ostream& out)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+
+    std::vector<Message> msgs;
+    bool                 complete = decode(contents.str(), msgs);
+    for (const auto& msg : msgs) {
+        out << msg.getMsg() << '\n';
+    }
+    return complete;
+}
+// Class BinaryLogDecoder ends
+
+} // namespace Au::Logger
@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Logger/LogWriter.hh"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <limits>
+#include <unistd.h>
+#endif
+
+namespace Au::Logger {
+
+#if defined(_WIN32) || defined(_WIN64)
+void
+LogWriter::setCrashFlush(bool enable, int fd)
+{
+    // Not supported, messages pending at a crash are lost
+    (void)enable;
+    (void)fd;
+}
+#else
+namespace {
+    constexpr int    cCrashSignals[] = { SIGSEGV, SIGABRT, SIGBUS, SIGFPE,
+                                         SIGILL };
+    constexpr size_t cSignalCount =
+        sizeof(cCrashSignals) / sizeof(cCrashSignals[0]);
+    // Priority column width, as in Message::appendMsg()
+    constexpr size_t cLevelWidth = 7;
+
+    // Handlers replaced by setCrashFlush(), guarded by instanceMutex
+    struct sigaction previousActions[cSignalCount];
+    bool             crashFlushInstalled = false;
+
+    std::atomic<int>  crashFd{ 2 };
+    std::atomic<bool> crashing{ false };
+
+    /**
+     * @brief Formats text into a buffer on the stack and writes it out with
+     * write(2), usable in a signal handler.
+     */
+    class CrashWriter
+    {
+      public:
+        explicit CrashWriter(int fd)
+            : m_fd{ fd }
+            , m_size{ 0 }
+            , m_buf{}
+        {
+        }
+
+        CrashWriter(const CrashWriter&)            = delete;
+        CrashWriter& operator=(const CrashWriter&) = delete;
+
+        ~CrashWriter() { flush(); }
+
+        void append(const char* data, size_t size)
+        {
+            while (size > 0) {
+                if (m_size == sizeof(m_buf)) {
+                    flush();
+                }
+                size_t chunk = std::min(size, sizeof(m_buf) - m_size);
+                std::memcpy(m_buf + m_size, data, chunk);
+                m_size += chunk;
+                data += chunk;
+                size -= chunk;
+            }
+        }
+
+        void append(StringView text) { append(text.data(), text.size()); }
+
+        void append(char c) { append(&c, 1); }
+
+        void appendUnsigned(Uint64 value, Uint32 base = 10, size_t width = 1)
+        {
+            char   digits[64];
+            size_t count = 0;
+            do {
+                digits[count++] = "0123456789abcdef"[value % base];
+                value /= base;
+            } while (value != 0);
+            while (count < width) {
+                digits[count++] = '0';
+            }
+            while (count > 0) {
+                append(digits[--count]);
+            }
+        }
+
+        void appendSigned(Int64 value)
+        {
+            Uint64 magnitude = static_cast<Uint64>(value);
+            if (value < 0) {
+                append('-');
+                magnitude = ~magnitude + 1;
+            }
+            appendUnsigned(magnitude);
+        }
+
+        // Six decimals like %f, with an exponent beyond the Uint64 range
+        void appendDouble(double value)
+        {
+            if (value != value) {
+                append("nan");
+                return;
+            }
+            if (value < 0) {
+                append('-');
+                value = -value;
+            }
+            if (value > std::numeric_limits<double>::max()) {
+                append("inf");
+                return;
+            }
+            Uint32 exponent = 0;
+            while (value >= 1e18) {
+                value /= 10;
+                exponent++;
+            }
+            Uint64 whole    = static_cast<Uint64>(value);
+            Uint64 fraction = static_cast<Uint64>(
+                (value - static_cast<double>(whole)) * 1e6 + 0.5);
+            if (fraction >= 1000000) {
+                whole++;
+                fraction -= 1000000;
+            }
+            appendUnsigned(whole);
+            append('.');
+            appendUnsigned(fraction, 10, 6);
+            if (exponent != 0) {
+                append("e+");
+                appendUnsigned(exponent);
+            }
+        }
+
+        void flush()
+        {
+            size_t done = 0;
+            while (done < m_size) {
+                ssize_t written = ::write(m_fd, m_buf + done, m_size - done);
+                if (written < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (written <= 0) {
+                    break;
+                }
+                done += static_cast<size_t>(written);
+            }
+            m_size = 0;
+        }
+
+      private:
+        int    m_fd;
+        size_t m_size;
+        char   m_buf[4096];
+    };
+
+    StringView levelName(Priority::PriorityLevel level)
+    {
+        switch (level) {
+            case Priority::PriorityLevel::eFatal:
+                return "Fatal";
+            case Priority::PriorityLevel::ePanic:
+                return "Panic";
+            case Priority::PriorityLevel::eError:
+                return "Error";
+            case Priority::PriorityLevel::eWarning:
+                return "Warning";
+            case Priority::PriorityLevel::eNotice:
+                return "Notice";
+            case Priority::PriorityLevel::eInfo:
+                return "Info";
+            case Priority::PriorityLevel::eDebug:
+                return "Debug";
+            case Priority::PriorityLevel::eTrace:
+            default:
+                return "Trace";
+        }
+    }
+
+    void appendArg(CrashWriter& out,
+                   char         conv,
+                   ArgType      type,
+                   Uint64       bits,
+                   double       real,
+                   StringView   str)
+    {
+        switch (type) {
+            case ArgType::eInt64:
+            case ArgType::eUint64:
+                if (conv == 'c') {
+                    out.append(static_cast<char>(bits));
+                } else if (conv == 'x' || conv == 'X') {
+                    out.appendUnsigned(bits, 16);
+                } else if (conv == 'o') {
+                    out.appendUnsigned(bits, 8);
+                } else if (type == ArgType::eInt64) {
+                    out.appendSigned(static_cast<Int64>(bits));
+                } else {
+                    out.appendUnsigned(bits);
+                }
+                break;
+            case ArgType::eDouble:
+                out.appendDouble(real);
+                break;
+            case ArgType::eString:
+                out.append(str);
+                break;
+            case ArgType::ePointer:
+                out.append("0x");
+                out.appendUnsigned(bits, 16);
+                break;
+        }
+    }
+
+    // Like formatDeferred(), widths and precisions are skipped
+    void appendDeferred(CrashWriter& out, const char* format, StringView args)
+    {
+        size_t     pos  = 0;
+        ArgType    type = ArgType::eInt64;
+        Uint64     bits = 0;
+        double     real = 0.0;
+        StringView str;
+
+        const char* p = format;
+        while (*p != '\0') {
+            if (*p != '%') {
+                out.append(*p++);
+                continue;
+            }
+            if (p[1] == '%') {
+                out.append('%');
+                p += 2;
+                continue;
+            }
+            const char* start = p++;
+            while (*p != '\0' && std::strchr("-+ #0123456789.hlLqjzt", *p)) {
+                p++;
+            }
+            if (*p == '\0') {
+                out.append(start, static_cast<size_t>(p - start));
+                break;
+            }
+            char conv = *p++;
+            if (conv == 'n') {
+                continue;
+            }
+            if (!decodeArg(args, pos, type, bits, real, str)) {
+                out.append(start, static_cast<size_t>(p - start));
+                continue;
+            }
+            appendArg(out, conv, type, bits, real, str);
+        }
+    }
+
+    // MessageVisitor writing "seconds.nanoseconds : Level   : text"
+    void writeMessage(const Message& msg, void* ctx)
+    {
+        CrashWriter& out = *static_cast<CrashWriter*>(ctx);
+
+        Uint64 ns = msg.getTimestamp().getNanosecond();
+        out.appendUnsigned(ns / 1000000000);
+        out.append('.');
+        out.appendUnsigned(ns % 1000000000, 10, 9);
+        out.append(" : ");
+        StringView level = levelName(msg.getPriority().getLevel());
+        out.append(level);
+        for (size_t i = level.size(); i < cLevelWidth; i++) {
+            out.append(' ');
+        }
+        out.append(" : ");
+
+        if (!msg.isDeferred()) {
+            out.append(msg.getPayload());
+        } else if (const char* format =
+                       FormatRegistry::get().peekFormat(msg.getFormatId())) {
+            appendDeferred(out, format, msg.getPayload());
+        } else {
+            out.append("(unknown format)");
+        }
+
+        // Fields are encoded as key, value pairs
+        StringView fields = msg.getEncodedFields();
+        size_t     pos    = 0;
+        ArgType    type   = ArgType::eInt64;
+        Uint64     bits   = 0;
+        double     real   = 0.0;
+        StringView key;
+        StringView str;
+        while (decodeArg(fields, pos, type, bits, real, key)
+               && decodeArg(fields, pos, type, bits, real, str)) {
+            out.append(' ');
+            out.append(key);
+            out.append('=');
+            appendArg(out, 'd', type, bits, real, str);
+        }
+        out.append('\n');
+    }
+
+    void crashHandler(int signal)
+    {
+        int savedErrno = errno;
+        // One dump, even if several threads crash
+        if (!crashing.exchange(true)) {
+            CrashWriter out(crashFd.load(std::memory_order_relaxed));
+            out.append("Log messages pending at signal ");
+            out.appendUnsigned(static_cast<Uint64>(signal));
+            out.append(":\n");
+            LogWriter::visitPending(&writeMessage, &out);
+        }
+
+        // Pass the signal on, it is delivered once this handler returns
+        for (size_t i = 0; i < cSignalCount; i++) {
+            if (cCrashSignals[i] == signal) {
+                sigaction(signal, &previousActions[i], nullptr);
+            }
+        }
+        errno = savedErrno;
+        raise(signal);
+    }
+} // namespace
+
+void
+LogWriter::setCrashFlush(bool enable, int fd)
+{
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    crashFd.store(fd, std::memory_order_relaxed);
+    if (enable == crashFlushInstalled) {
+        return;
+    }
+
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = &crashHandler;
+    sigemptyset(&action.sa_mask);
+    // Runs on the alternate stack if the application set one up, so that a
+    // stack overflow can be reported too
+    action.sa_flags = SA_ONSTACK;
+    for (size_t i = 0; i < cSignalCount; i++) {
+        if (enable) {
+            sigaction(cCrashSignals[i], &action, &previousActions[i]);
+        } else {
+            sigaction(cCrashSignals[i], &previousActions[i], nullptr);
+        }
+    }
+    crashFlushInstalled = enable;
+}
+#endif
+
+} // namespace Au::Logger
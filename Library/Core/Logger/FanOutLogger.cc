@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Logger/FanOutLogger.hh"
+#include "Park.hh"
+
+#include <type_traits>
+
+namespace Au::Logger {
+
+namespace {
+    // Messages handed to a sink logger per writeBatch() call
+    constexpr size_t cSinkBatchSize = 256;
+    // Times a sink thread checks its empty queue before it parks
+    constexpr Uint32 cSpinCount = 64;
+    // Upper bound for a single park, guards against a missed wakeup
+    constexpr std::chrono::milliseconds cMaxParkTime{ 100 };
+    // The LogWriter thread wakes a sink at least this often while copying a
+    // batch, so a bounded sink queue gets drained
+    constexpr size_t cNotifyInterval = 64;
+} // namespace
+
+// Class FanOutLogger begins
+FanOutLogger::Sink::Sink(std::unique_ptr<ILogger> logger,
+                         Uint32                   levelMask,
+                         std::unique_ptr<IQueue>  queue)
+    : m_logger{ std::move(logger) }
+    , m_levelMask{ levelMask }
+    , m_queue{ std::move(queue) }
+    , m_thread{}
+    , m_running{ true }
+    , m_parked{ false }
+    , m_flushRequests{ 0 }
+    , m_flushesDone{ 0 }
+    , m_mutex{}
+    , m_wakeCv{}
+    , m_flushCv{}
+{
+}
+
+FanOutLogger::FanOutLogger()
+    : GenericLogger()
+    , m_sinks{}
+{
+}
+
+size_t
+FanOutLogger::addSink(std::unique_ptr<ILogger> logger,
+                      Uint32                   levelMask,
+                      std::unique_ptr<IQueue>  queue)
+{
+    if (!queue) {
+        queue = std::make_unique<RingQueue>(cDefaultQueueCapacity,
+                                            OverflowPolicy::eDropNewest);
+    }
+    auto sink = std::make_unique<Sink>(
+        std::move(logger), levelMask, std::move(queue));
+    sink->m_thread = std::thread(&FanOutLogger::sinkThread, std::ref(*sink));
+    m_sinks.push_back(std::move(sink));
+    return m_sinks.size() - 1;
+}
+
+void
+FanOutLogger::setLevelMask(size_t index, Uint32 levelMask)
+{
+    m_sinks.at(index)->m_levelMask.store(levelMask, std::memory_order_relaxed);
+}
+
+size_t
+FanOutLogger::getSinkCount() const
+{
+    return m_sinks.size();
+}
+
+Uint64
+FanOutLogger::getDroppedCount(size_t index) const
+{
+    return m_sinks.at(index)->m_queue->getDroppedCount();
+}
+
+Uint64
+FanOutLogger::getBytesWritten() const
+{
+    Uint64 bytes = 0;
+    for (const auto& sink : m_sinks) {
+        bytes += sink->m_logger->getBytesWritten();
+    }
+    return bytes;
+}
+
+void
+FanOutLogger::sinkThread(Sink& sink)
+{
+    std::vector<Message> batch;
+    batch.reserve(cSinkBatchSize);
+    Message msg("");
+
+    auto hasWork = [&sink] {
+        return !sink.m_queue->empty() || !sink.m_running
+               || sink.m_flushRequests != sink.m_flushesDone;
+    };
+
+    for (;;) {
+        // Read before draining, messages queued ahead of a flush() call must
+        // be written before it is served
+        Uint64 flushRequests = sink.m_flushRequests;
+        while (batch.size() < cSinkBatchSize
+               && sink.m_queue->tryDequeue(msg)) {
+            batch.push_back(std::move(msg));
+        }
+        if (!batch.empty()) {
+            sink.m_logger->writeBatch(batch);
+            batch.clear();
+            continue;
+        }
+
+        if (flushRequests != sink.m_flushesDone) {
+            sink.m_logger->flush();
+            std::lock_guard<std::mutex> lock(sink.m_mutex);
+            sink.m_flushesDone = flushRequests;
+            sink.m_flushCv.notify_all();
+            continue;
+        }
+        if (!sink.m_running) {
+            // Queue is empty, nothing left to write
+            break;
+        }
+        if (!spinFor(cSpinCount, hasWork)) {
+            parkFor(sink.m_mutex,
+                    sink.m_wakeCv,
+                    sink.m_parked,
+                    cMaxParkTime,
+                    hasWork);
+        }
+    }
+}
+
+void
+FanOutLogger::notify(Sink& sink)
+{
+    wakeParked(sink.m_mutex, sink.m_wakeCv, sink.m_parked);
+}
+
+bool
+FanOutLogger::accepts(const Sink& sink, const Message& msg)
+{
+    auto level = static_cast<Uint32>(msg.getPriority().getLevel());
+    return (level & sink.m_levelMask.load(std::memory_order_relaxed)) != 0;
+}
+
+void
+FanOutLogger::write(const Message& msg)
+{
+    for (auto& sink : m_sinks) {
+        if (accepts(*sink, msg)) {
+            sink->m_queue->enqueue(msg);
+            notify(*sink);
+        }
+    }
+}
+
+void
+FanOutLogger::write(Message&& msg)
+{
+    // The last sink taking the message gets it moved, the others a copy
+    Sink* last = nullptr;
+    for (auto& sink : m_sinks) {
+        if (!accepts(*sink, msg)) {
+            continue;
+        }
+        if (last != nullptr) {
+            last->m_queue->enqueue(msg);
+            notify(*last);
+        }
+        last = sink.get();
+    }
+    if (last != nullptr) {
+        last->m_queue->enqueue(std::move(msg));
+        notify(*last);
+    }
+}
+
+template<typename Batch>
+void
+FanOutLogger::dispatch(Batch& msgs)
+{
+    // One snapshot of the masks for the batch, the last sink taking a
+    // message may move it and must be the same in every pass
+    std::vector<Uint32> masks;
+    masks.reserve(m_sinks.size());
+    for (auto& sink : m_sinks) {
+        masks.push_back(sink->m_levelMask.load(std::memory_order_relaxed));
+    }
+
+    for (size_t i = 0; i < m_sinks.size(); i++) {
+        Sink&  sink  = *m_sinks[i];
+        size_t count = 0;
+        for (auto& msg : msgs) {
+            auto level = static_cast<Uint32>(msg.getPriority().getLevel());
+            if ((level & masks[i]) == 0) {
+                continue;
+            }
+            bool last = true;
+            for (size_t j = i + 1; j < masks.size() && last; j++) {
+                last = (level & masks[j]) == 0;
+            }
+            if constexpr (std::is_const_v<Batch>) {
+                sink.m_queue->enqueue(msg);
+            } else if (last) {
+                sink.m_queue->enqueue(std::move(msg));
+            } else {
+                sink.m_queue->enqueue(msg);
+            }
+            if (++count % cNotifyInterval == 0) {
+                notify(sink);
+            }
+        }
+        if (count > 0) {
+            notify(sink);
+        }
+    }
+}
+
+void
+FanOutLogger::writeBatch(const std::vector<Message>& msgs)
+{
+    dispatch(msgs);
+}
+
+void
+FanOutLogger::consumeBatch(std::vector<Message>& msgs)
+{
+    dispatch(msgs);
+}
+
+void
+FanOutLogger::flush()
+{
+    // Ask every sink first, so they flush in parallel
+    std::vector<Uint64> tickets;
+    tickets.reserve(m_sinks.size());
+    for (auto& sink : m_sinks) {
+        std::lock_guard<std::mutex> lock(sink->m_mutex);
+        tickets.push_back(++sink->m_flushRequests);
+        sink->m_wakeCv.notify_one();
+    }
+    for (size_t i = 0; i < m_sinks.size(); i++) {
+        Sink&                        sink = *m_sinks[i];
+        std::unique_lock<std::mutex> lock(sink.m_mutex);
+        sink.m_flushCv.wait(
+            lock, [&] { return sink.m_flushesDone >= tickets[i]; });
+    }
+}
+
+String
+FanOutLogger::getLoggerType() const
+{
+    return "FanOutLogger";
+}
+
+FanOutLogger::~FanOutLogger()
+{
+    for (auto& sink : m_sinks) {
+        {
+            std::lock_guard<std::mutex> lock(sink->m_mutex);
+            sink->m_running = false;
+        }
+        sink->m_wakeCv.notify_one();
+    }
+    for (auto& sink : m_sinks) {
+        sink->m_thread.join();
+        sink->m_logger->flush();
+    }
+}
+
+// Class FanOutLogger ends
+} // namespace Au::Logger
@@ -0,0 +1,439 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Logger/Format.hh"
+#include "Au/Logger/MessageBuffer.hh"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace Au::Logger {
+
+// Class FormatRegistry begins
+FormatRegistry::FormatRegistry()
+    : m_mutex{}
+    , m_formats{ "%s" } // cPlainTextId
+    , m_interned{}
+{
+}
+
+FormatRegistry&
+FormatRegistry::get()
+{
+    // Never destroyed, the logging thread may format messages during exit
+    static FormatRegistry* registry = new FormatRegistry();
+    return *registry;
+}
+
+Uint32
+FormatRegistry::registerFormat(const char* format)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_formats.emplace_back(format == nullptr ? "" : format);
+    return static_cast<Uint32>(m_formats.size() - 1);
+}
+
+Uint32
+FormatRegistry::internFormat(const char* format)
+{
+    String                      text(format == nullptr ? "" : format);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto                        it = m_interned.find(text);
+    if (it != m_interned.end()) {
+        return it->second;
+    }
+    if (m_interned.size() >= cMaxInterned) {
+        return cNoFormatId;
+    }
+    Uint32 id = static_cast<Uint32>(m_formats.size());
+    m_formats.push_back(text);
+    m_interned.emplace(std::move(text), id);
+    return id;
+}
+
+const String&
+FormatRegistry::getFormat(Uint32 id)
+{
+    static const String empty{};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id >= m_formats.size()) {
+        return empty;
+    }
+    return m_formats[id];
+}
+
+const char*
+FormatRegistry::peekFormat(Uint32 id) const
+{
+    return id < m_formats.size() ? m_formats[id].c_str() : nullptr;
+}
+
+Uint32
+FormatRegistry::getCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<Uint32>(m_formats.size());
+}
+// Class FormatRegistry ends
+
+bool
+decodeArg(StringView  args,
+          size_t&     pos,
+          ArgType&    type,
+          Uint64&     bits,
+          double&     real,
+          StringView& str)
+{
+    auto readRaw = [&](auto& value) {
+        if (pos + sizeof(value) > args.size()) {
+            return false;
+        }
+        std::memcpy(&value, args.data() + pos, sizeof(value));
+        pos += sizeof(value);
+        return true;
+    };
+
+    if (pos >= args.size()) {
+        return false;
+    }
+    type = static_cast<ArgType>(args[pos++]);
+    switch (type) {
+        case ArgType::eInt64:
+        case ArgType::eUint64:
+        case ArgType::ePointer:
+            return readRaw(bits);
+        case ArgType::eDouble:
+            return readRaw(real);
+        case ArgType::eString: {
+            Uint32 size = 0;
+            if (!readRaw(size) || pos + size > args.size()) {
+                return false;
+            }
+            str = args.substr(pos, size);
+            pos += size;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+namespace {
+    bool isOneOf(char c, const char* set)
+    {
+        return c != '\0' && std::strchr(set, c) != nullptr;
+    }
+
+    bool isIntConversion(char conv)
+    {
+        return conv == 'd' || conv == 'i' || conv == 'o' || conv == 'u'
+               || conv == 'x' || conv == 'X' || conv == 'c';
+    }
+
+    bool isFloatConversion(char conv)
+    {
+        return conv == 'e' || conv == 'E' || conv == 'f' || conv == 'F'
+               || conv == 'g' || conv == 'G' || conv == 'a' || conv == 'A';
+    }
+
+    template<typename T>
+    void appendFormatted(String& out, const String& spec, T value)
+    {
+        char buf[64];
+        int  len = std::snprintf(buf, sizeof(buf), spec.c_str(), value);
+        if (len < 0) {
+            return;
+        }
+        if (static_cast<size_t>(len) < sizeof(buf)) {
+            out.append(buf, len);
+            return;
+        }
+        std::vector<char> big(static_cast<size_t>(len) + 1);
+        std::snprintf(big.data(), big.size(), spec.c_str(), value);
+        out.append(big.data(), len);
+    }
+
+    /**
+     * @brief Renders one argument, spec is the conversion without length
+     * modifier, e.g. "%-8." and conv 'd'.
+     */
+    void appendArg(String&       out,
+                   const String& spec,
+                   char          conv,
+                   ArgType       type,
+                   Uint64        bits,
+                   double        real,
+                   StringView    str)
+    {
+        switch (type) {
+            case ArgType::eInt64:
+            case ArgType::eUint64:
+                if (conv == 'c') {
+                    appendFormatted(out, spec + 'c', static_cast<int>(bits));
+                } else if (isFloatConversion(conv)) {
+                    double value = type == ArgType::eInt64
+                                       ? static_cast<double>(
+                                           static_cast<Int64>(bits))
+                                       : static_cast<double>(bits);
+                    appendFormatted(out, spec + conv, value);
+                } else if (conv == 'd' || conv == 'i'
+                           || (conv == 's' && type == ArgType::eInt64)) {
+                    appendFormatted(
+                        out, spec + "lld", static_cast<long long>(bits));
+                } else if (isIntConversion(conv)) {
+                    appendFormatted(out,
+                                    spec + "ll" + conv,
+                                    static_cast<unsigned long long>(bits));
+                } else {
+                    appendFormatted(
+                        out, spec + "llu", static_cast<unsigned long long>(bits));
+                }
+                break;
+            case ArgType::eDouble:
+                if (isFloatConversion(conv)) {
+                    appendFormatted(out, spec + conv, real);
+                } else if (isIntConversion(conv) && conv != 'c') {
+                    appendFormatted(
+                        out, spec + "lld", static_cast<long long>(real));
+                } else {
+                    appendFormatted(out, spec + 'g', real);
+                }
+                break;
+            case ArgType::eString:
+                if (conv == 's' && spec == "%") {
+                    out += str;
+                } else if (conv == 's') {
+                    appendFormatted(out, spec + 's', String(str).c_str());
+                } else {
+                    out += str;
+                }
+                break;
+            case ArgType::ePointer:
+                if (conv == 'p' || conv == 's') {
+                    appendFormatted(out,
+                                    spec + 'p',
+                                    reinterpret_cast<void*>(
+                                        static_cast<std::uintptr_t>(bits)));
+                } else {
+                    appendFormatted(out,
+                                    spec + "ll" + (isIntConversion(conv) ? conv : 'x'),
+                                    static_cast<unsigned long long>(bits));
+                }
+                break;
+        }
+    }
+} // namespace
+
+template<typename Buffer>
+void
+encodeVarArgs(Buffer& buf, const char* format, va_list args)
+{
+    enum class Length
+    {
+        eNone,
+        eChar,
+        eShort,
+        eLong,
+        eLongLong,
+        eSize,
+        eIntMax,
+        ePtrDiff,
+        eLongDouble,
+    };
+
+    for (const char* p = format; p != nullptr && *p != '\0'; p++) {
+        if (*p != '%') {
+            continue;
+        }
+        if (*++p == '%') {
+            continue;
+        }
+
+        while (isOneOf(*p, "-+ #0'")) {
+            p++;
+        }
+        while (isOneOf(*p, "0123456789.*")) {
+            if (*p++ == '*') {
+                return;
+            }
+        }
+
+        Length length = Length::eNone;
+        switch (*p) {
+            case 'h':
+                length = p[1] == 'h' ? Length::eChar : Length::eShort;
+                p += p[1] == 'h' ? 2 : 1;
+                break;
+            case 'l':
+                length = p[1] == 'l' ? Length::eLongLong : Length::eLong;
+                p += p[1] == 'l' ? 2 : 1;
+                break;
+            case 'q':
+                length = Length::eLongLong;
+                p++;
+                break;
+            case 'z':
+                length = Length::eSize;
+                p++;
+                break;
+            case 'j':
+                length = Length::eIntMax;
+                p++;
+                break;
+            case 't':
+                length = Length::ePtrDiff;
+                p++;
+                break;
+            case 'L':
+                length = Length::eLongDouble;
+                p++;
+                break;
+            default:
+                break;
+        }
+
+        char conv = *p;
+        if (conv == 'd' || conv == 'i' || conv == 'c') {
+            // char and short arrive promoted to int
+            switch (length) {
+                case Length::eLong:
+                    detail::encodeArg(buf, va_arg(args, long));
+                    break;
+                case Length::eLongLong:
+                    detail::encodeArg(buf, va_arg(args, long long));
+                    break;
+                case Length::eSize:
+                case Length::ePtrDiff:
+                    detail::encodeArg(buf, va_arg(args, std::ptrdiff_t));
+                    break;
+                case Length::eIntMax:
+                    detail::encodeArg(buf, va_arg(args, intmax_t));
+                    break;
+                default:
+                    detail::encodeArg(buf, va_arg(args, int));
+                    break;
+            }
+        } else if (isIntConversion(conv)) {
+            switch (length) {
+                case Length::eLong:
+                    detail::encodeArg(buf, va_arg(args, unsigned long));
+                    break;
+                case Length::eLongLong:
+                    detail::encodeArg(buf, va_arg(args, unsigned long long));
+                    break;
+                case Length::eSize:
+                case Length::ePtrDiff:
+                    detail::encodeArg(buf, va_arg(args, size_t));
+                    break;
+                case Length::eIntMax:
+                    detail::encodeArg(buf, va_arg(args, uintmax_t));
+                    break;
+                default:
+                    detail::encodeArg(buf, va_arg(args, unsigned int));
+                    break;
+            }
+        } else if (isFloatConversion(conv)) {
+            if (length == Length::eLongDouble) {
+                detail::encodeArg(buf, va_arg(args, long double));
+            } else {
+                detail::encodeArg(buf, va_arg(args, double));
+            }
+        } else if (conv == 's') {
+            detail::encodeArg(buf, va_arg(args, const char*));
+        } else if (conv == 'p') {
+            detail::encodeArg(buf, va_arg(args, void*));
+        } else if (conv == 'n') {
+            (void)va_arg(args, void*);
+        } else {
+            return;
+        }
+    }
+}
+
+template void
+encodeVarArgs(String& buf, const char* format, va_list args);
+template void
+encodeVarArgs(MessageBuffer& buf, const char* format, va_list args);
+
+String
+formatDeferred(const String& format, StringView args)
+{
+    String out;
+    size_t pos = 0;
+    out.reserve(format.size() + args.size());
+
+    ArgType    type = ArgType::eInt64;
+    Uint64     bits = 0;
+    double     real = 0.0;
+    StringView str;
+
+    size_t i = 0;
+    while (i < format.size()) {
+        char c = format[i];
+        if (c != '%') {
+            out += c;
+            i++;
+            continue;
+        }
+        if (i + 1 < format.size() && format[i + 1] == '%') {
+            out += '%';
+            i += 2;
+            continue;
+        }
+
+        // Collect flags, width and precision, skip length modifiers
+        size_t start = i++;
+        String spec  = "%";
+        while (i < format.size() && isOneOf(format[i], "-+ #'0123456789.")) {
+            spec += format[i++];
+        }
+        while (i < format.size() && isOneOf(format[i], "hlLqjzt")) {
+            i++;
+        }
+        if (i >= format.size()) {
+            // Dangling conversion, keep it verbatim
+            out.append(format, start, String::npos);
+            break;
+        }
+        char conv = format[i++];
+        if (conv == 'n') {
+            continue;
+        }
+        if (!decodeArg(args, pos, type, bits, real, str)) {
+            // Not enough arguments, keep the conversion verbatim
+            out.append(format, start, i - start);
+            continue;
+        }
+        appendArg(out, spec, conv, type, bits, real, str);
+    }
+    return out;
+}
+
+} // namespace Au::Logger
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Logger/Logger.hh"
+#include "Json.hh"
+
+#include <charconv>
+#include <cmath>
+
+namespace Au::Logger {
+
+namespace {
+    template<typename T>
+    void appendNumber(String& out, T value)
+    {
+        char buf[32];
+        auto res = std::to_chars(buf, buf + sizeof(buf), value);
+        out.append(buf, static_cast<size_t>(res.ptr - buf));
+    }
+
+    void appendJsonValue(String& out, const Field& field)
+    {
+        switch (field.type) {
+            case ArgType::eInt64:
+                appendNumber(out, static_cast<Int64>(field.bits));
+                break;
+            case ArgType::eUint64:
+                appendNumber(out, field.bits);
+                break;
+            case ArgType::eDouble:
+                if (std::isfinite(field.real)) {
+                    appendNumber(out, field.real);
+                } else {
+                    out += "null";
+                }
+                break;
+            case ArgType::eString:
+                appendJsonString(out, field.text);
+                break;
+            case ArgType::ePointer: {
+                char buf[32] = { '"', '0', 'x' };
+                auto res     = std::to_chars(buf + 3, buf + 31, field.bits, 16);
+                *res.ptr++   = '"';
+                out.append(buf, static_cast<size_t>(res.ptr - buf));
+                break;
+            }
+        }
+    }
+} // namespace
+
+// Class JsonFileLogger begins
+JsonFileLogger::JsonFileLogger(const String& filename)
+    : FileLogger(filename, "a")
+    , m_fields{}
+{
+}
+
+void
+JsonFileLogger::appendRecord(const Message& msg)
+{
+    // {"ts":1725276696000000000,"level":"Info","msg":"...","fields":{...}}
+    m_buffer += "{\"ts\":";
+    appendNumber(m_buffer, msg.getTimestamp().getNanosecond());
+    m_buffer += ",\"level\":";
+    appendJsonString(m_buffer, msg.getPriority().toStr());
+    m_buffer += ",\"msg\":";
+    if (msg.isDeferred()) {
+        appendJsonString(m_buffer, msg.getText());
+    } else {
+        appendJsonString(m_buffer, msg.getPayload());
+    }
+
+    if (msg.hasFields()) {
+        m_buffer += ",\"fields\":{";
+        msg.getFields(m_fields);
+        for (size_t i = 0; i < m_fields.size(); i++) {
+            if (i > 0) {
+                m_buffer += ',';
+            }
+            appendJsonString(m_buffer, m_fields[i].key);
+            m_buffer += ':';
+            appendJsonValue(m_buffer, m_fields[i]);
+        }
+        m_buffer += '}';
+    }
+    m_buffer += "}\n";
+}
+
+void
+JsonFileLogger::write(const Message& msg)
+{
+    if (m_file == nullptr) {
+        return;
+    }
+    m_buffer.clear();
+    appendRecord(msg);
+    writeBuffer();
+}
+
+void
+JsonFileLogger::writeBatch(const std::vector<Message>& msgs)
+{
+    if (m_file == nullptr) {
+        return;
+    }
+    m_buffer.clear();
+    for (const auto& msg : msgs) {
+        appendRecord(msg);
+    }
+    writeBuffer();
+}
+
+String
+JsonFileLogger::getLoggerType() const
+{
+    return "JsonFileLogger";
+}
+// Class JsonFileLogger ends
+} // namespace Au::Logger
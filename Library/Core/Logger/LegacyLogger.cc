@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Logger.hh"
+#include "Au/Logger/FanOutLogger.hh"
+#include "Au/Logger/LogWriter.hh"
+
+namespace Au::Logger {
+
+namespace {
+    // File the legacy logger writes to when file logging is on
+    constexpr const char* cLegacyLogFile = "cpuidlog.txt";
+
+    Priority::PriorityLevel toPriorityLevel(LogLevel level)
+    {
+        switch (level) {
+            case LogLevel::DEBUG:
+                return Priority::PriorityLevel::eDebug;
+            case LogLevel::INFO:
+                return Priority::PriorityLevel::eInfo;
+            case LogLevel::WARNING:
+                return Priority::PriorityLevel::eWarning;
+            case LogLevel::ERROR:
+                return Priority::PriorityLevel::eError;
+            case LogLevel::CRITICAL:
+                break;
+        }
+        return Priority::PriorityLevel::ePanic;
+    }
+} // namespace
+
+// Class LegacyLogger begins
+LegacyLogger::LegacyLogger(LogLevel level, bool logToFile)
+    : m_logLevel{ level }
+    , m_logToFile{ false }
+    , m_file{}
+    , m_fileMutex{}
+{
+    if (level >= LogLevel::CRITICAL) {
+        if (AU_BUILD_TYPE_RELEASE)
+            m_logLevel = LogLevel::CRITICAL;
+        else if (AU_BUILD_TYPE_DEBUG)
+            m_logLevel = LogLevel::INFO;
+        else if (AU_BUILD_TYPE_DEVELOPER)
+            m_logLevel = LogLevel::DEBUG;
+    }
+    setLevel(m_logLevel, logToFile);
+}
+
+LegacyLogger::~LegacyLogger() = default;
+
+LegacyLogger&
+LegacyLogger::getInstance()
+{
+    static LegacyLogger instance;
+    return instance;
+}
+
+std::ostringstream&
+LegacyLogger::getStream()
+{
+    thread_local std::ostringstream stream;
+    thread_local const std::ios     defaults{ nullptr };
+
+    stream.str(String());
+    stream.clear();
+    stream.copyfmt(defaults);
+    return stream;
+}
+
+void
+LegacyLogger::submit(LogLevel level, const std::ostringstream& stream)
+{
+    Priority::PriorityLevel priorityLevel = toPriorityLevel(level);
+    if (!LogWriter::isLevelEnabled(priorityLevel)) {
+        return;
+    }
+
+    Message message(stream.str(), Priority(priorityLevel));
+    // The lock is only taken while file logging is on
+    if (m_logToFile.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(m_fileMutex);
+        if (m_file) {
+            m_file->write(message);
+        }
+    }
+    LogWriter::current().log(std::move(message));
+}
+
+void
+LegacyLogger::setLevel(LogLevel level, bool logToFile)
+{
+    m_logLevel = level;
+    if (logToFile == m_logToFile.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // Only legacy messages go to the file, through a sink of its own rather
+    // than the logger the application gave the LogWriter
+    std::unique_ptr<FanOutLogger> file;
+    if (logToFile) {
+        file = std::make_unique<FanOutLogger>();
+        file->addSink(std::make_unique<FileLogger>(cLegacyLogFile),
+                      levelMaskUpTo(Priority::PriorityLevel::eTrace));
+    }
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+    m_file.swap(file);
+    m_logToFile.store(logToFile, std::memory_order_release);
+}
+// Class LegacyLogger ends
+
+} // namespace Au::Logger
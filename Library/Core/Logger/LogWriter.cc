@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -27,41 +27,355 @@
  */
 
 #include "Au/Logger/LogWriter.hh"
+#include "Au/Logger/LogManager.hh"
+#include "Park.hh"
+#include "WriterPlacement.hh"
 
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
 #include <mutex>
 
-#define USE_NO_LOCK 0
-
 namespace Au::Logger {
 
 std::shared_ptr<LogWriter> LogWriter::instance = nullptr;
 std::mutex                 LogWriter::instanceMutex;
+std::atomic<Uint64>        LogWriter::generation{ 0 };
+std::atomic<Uint32>        LogWriter::level{
+    static_cast<Uint32>(Priority::PriorityLevel::eTrace)
+};
+std::atomic<Uint32>  LogWriter::rateLimit{ 0 };
+LogWriter::Counters LogWriter::counters{};
+
+namespace {
+    // Bounds for the adaptive spin phase of WakeupMode::eSpinThenPark
+    constexpr Uint32 cMinSpinCount = 16;
+    constexpr Uint32 cMaxSpinCount = 4096;
+    // Upper bound for a single park, guards against a missed wakeup
+    constexpr std::chrono::milliseconds cMaxParkTime{ 100 };
+    // Messages handed to the logger per writeBatch() call by default
+    constexpr size_t cDefaultBatchSize = 256;
+    // Producers wake the logging thread at least this often, so a bounded
+    // queue filled by one large log() call gets drained
+    constexpr size_t cNotifyInterval = 64;
+    // A run of repeated messages is reported at least this often
+    constexpr std::chrono::seconds cRepeatReportInterval{ 1 };
+    // One in this many log() calls of a thread is timed for the statistics
+    constexpr Uint32 cEnqueueSampleInterval = 64;
+
+    bool sampleEnqueue()
+    {
+        thread_local Uint32 calls = 0;
+        return calls++ % cEnqueueSampleInterval == 0;
+    }
+    // LogWriter::shutdown() is registered with atexit() once, guarded by
+    // instanceMutex
+    bool atExitRegistered = false;
+} // namespace
 
 // Class LogWriter begins
 void
 LogWriter::loggerThread()
 {
+    std::vector<Message> batch;
+    batch.reserve(cDefaultBatchSize);
+    m_coalesced.reserve(cDefaultBatchSize);
+    bool   dirty     = false;
+    auto   lastFlush = std::chrono::steady_clock::now();
+    auto   lastTick  = lastFlush;
+    Uint32 placed    = applyPlacement();
+
     while (m_running) {
-        if (!m_queue.empty()) {
-            Message msg = m_queue.dequeue();
+        if (placed != m_placements.load(std::memory_order_relaxed)) {
+            placed = applyPlacement();
+        }
+        // Read before checking the queue, messages logged ahead of a flush()
+        // call must be written before it is served
+        Uint64 flushRequests = m_flushRequests;
+        if (m_queue->empty()) {
+            // Drained, a monitor must not see the last batch as backlog.
+            // Stored before a flush is served, flush() callers see 0
+            counters.queueDepth.store(0, std::memory_order_relaxed);
+            if (flushRequests != m_flushesDone) {
+                reportRepeats();
+                writeBatch(batch);
+                m_logger->flush();
+                lastFlush = std::chrono::steady_clock::now();
+                dirty     = false;
+                serveFlush(flushRequests);
+                lastTick = tick(lastTick, true);
+            }
+            markIdle();
+            waitForMessages(dirty);
+            lastTick = tick(lastTick, false);
+        } else {
+            // Must be visible before the queue is seen empty by drain()
+            m_idle = false;
+            fillBatch(batch);
+            if (!batch.empty()) {
+                // A full batch may have left more behind, a partial one
+                // emptied the queue. getCount() locks some queues, so it is
+                // only asked when the answer can be non-zero
+                Uint64 depth = batch.size();
+                if (batch.size() >= m_batchSize) {
+                    depth += m_queue->getCount();
+                }
+                counters.queueDepth.store(depth, std::memory_order_relaxed);
+                if (depth > counters.maxQueueDepth.load(
+                        std::memory_order_relaxed)) {
+                    counters.maxQueueDepth.store(depth,
+                                                 std::memory_order_relaxed);
+                }
+                counters.messagesWritten.store(
+                    counters.messagesWritten.load(std::memory_order_relaxed)
+                        + batch.size(),
+                    std::memory_order_relaxed);
 
-            // FIXME: Find better way, move to assert
-            /*
-            if (msg.getMsg().find("Empty Queue") != String::npos) {
-                continue;
+                // Wall clock offset for the messages of this batch
+                Timestamp::rebase();
+                writeBatch(batch);
+                dirty = true;
+            } else {
+                // A producer claimed a slot but has not published it yet
+                std::this_thread::yield();
             }
-            */
-            m_logger->write(msg);
+            lastTick = tick(lastTick, true);
+        }
+
+        if (m_repeats > 0
+            && std::chrono::steady_clock::now() - m_repeatsSince
+                   >= cRepeatReportInterval) {
+            reportRepeats();
+            writeBatch(batch);
+            dirty = true;
+        }
+
+        auto interval = std::chrono::milliseconds(m_flushIntervalMs.load());
+        if (dirty && interval.count() > 0) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastFlush >= interval) {
+                m_logger->flush();
+                lastFlush = now;
+                dirty     = false;
+            }
+        }
+    }
+
+    // Stopping, the count of a run in progress still goes out
+    reportRepeats();
+    writeBatch(batch);
+    m_hasLast = false;
+    tick(lastTick, true);
+}
+
+std::chrono::steady_clock::time_point
+LogWriter::tick(std::chrono::steady_clock::time_point since, bool busy)
+{
+    // Single writer, plain stores are enough
+    auto add = [](std::atomic<Uint64>& counter, Uint64 value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value,
+                      std::memory_order_relaxed);
+    };
+
+    auto   now     = std::chrono::steady_clock::now();
+    Uint64 elapsed = static_cast<Uint64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - since)
+            .count());
+    add(counters.writerRunNs, elapsed);
+    if (!busy) {
+        return now;
+    }
+    add(counters.writerBusyNs, elapsed);
+
+    Uint64 bytes = m_logger->getBytesWritten();
+    if (bytes > m_loggerBytes) {
+        add(counters.bytesWritten, bytes - m_loggerBytes);
+    }
+    m_loggerBytes = bytes;
+    Uint64 dropped = m_queue->getDroppedCount();
+    if (dropped > m_queueDropped) {
+        add(counters.messagesDropped, dropped - m_queueDropped);
+    }
+    m_queueDropped = dropped;
+    return now;
+}
+
+void
+LogWriter::recordEnqueue(std::chrono::steady_clock::duration elapsed,
+                         size_t                              count)
+{
+    Uint64 ns = static_cast<Uint64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    ns /= std::max<size_t>(count, 1);
+
+    counters.enqueueSamples.fetch_add(1, std::memory_order_relaxed);
+    counters.enqueueTotalNs.fetch_add(ns, std::memory_order_relaxed);
+    Uint64 max = counters.enqueueMaxNs.load(std::memory_order_relaxed);
+    while (ns > max
+           && !counters.enqueueMaxNs.compare_exchange_weak(
+               max, ns, std::memory_order_relaxed)) {
+    }
+}
+
+void
+LogWriter::writeBatch(std::vector<Message>& batch)
+{
+    if (!m_coalesce && m_repeats == 0 && m_coalesced.empty()) {
+        m_hasLast = false;
+        if (!batch.empty()) {
+            m_logger->consumeBatch(batch);
+        }
+        batch.clear();
+        return;
+    }
+
+    for (auto& msg : batch) {
+        if (m_coalesce && m_hasLast && msg.hasSameContent(m_last)) {
+            if (m_repeats++ == 0) {
+                m_repeatsSince = std::chrono::steady_clock::now();
+            }
+            continue;
+        }
+        reportRepeats();
+        m_last    = msg;
+        m_hasLast = m_coalesce;
+        m_coalesced.push_back(std::move(msg));
+    }
+    batch.clear();
+    if (!m_coalesced.empty()) {
+        m_logger->consumeBatch(m_coalesced);
+        m_coalesced.clear();
+    }
+}
+
+void
+LogWriter::reportRepeats()
+{
+    if (m_repeats == 0) {
+        return;
+    }
+    static const Uint32 formatId = FormatRegistry::get().registerFormat(
+        "Last message repeated %llu times");
+    m_coalesced.push_back(
+        Message::deferred(formatId, m_last.getPriority(), m_repeats));
+    m_repeats = 0;
+}
+
+void
+LogWriter::fillBatch(std::vector<Message>& batch)
+{
+    const size_t batchSize = m_batchSize;
+    const auto   delay = std::chrono::microseconds(m_maxBatchDelayUs.load());
+    const auto   start = std::chrono::steady_clock::now();
+
+    Message msg("");
+    while (batch.size() < batchSize) {
+        if (m_queue->tryDequeue(msg)) {
+            batch.push_back(std::move(msg));
+            continue;
+        }
+        if (batch.empty() || delay.count() == 0 || !m_running
+            || std::chrono::steady_clock::now() - start >= delay) {
+            break;
         }
+        std::this_thread::yield();
+    }
+}
+
+void
+LogWriter::waitForMessages(bool dirty)
+{
+    if (m_wakeupMode == WakeupMode::eBusySpin) {
+        return;
+    }
+
+    auto hasWork = [this] {
+        return !m_queue->empty() || !m_running
+               || m_flushRequests != m_flushesDone;
+    };
+
+    // Spin phase, grows while messages keep arriving within it
+    Uint32 spinLimit = m_spinLimit;
+    if (spinFor(spinLimit, hasWork)) {
+        m_spinLimit = std::min(spinLimit * 2, cMaxSpinCount);
+        return;
+    }
+    m_spinLimit = std::max(spinLimit / 2, cMinSpinCount);
+
+    // Park phase
+    auto timeout  = cMaxParkTime;
+    auto interval = std::chrono::milliseconds(m_flushIntervalMs.load());
+    if (dirty && interval.count() > 0) {
+        timeout = std::min(timeout, interval);
+    }
+    parkFor(m_wakeMutex, m_wakeCv, m_parked, timeout, hasWork);
+}
+
+void
+LogWriter::markIdle()
+{
+    if (m_idle) {
+        return;
     }
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_idle = true;
+    m_drainCv.notify_all();
+}
+
+void
+LogWriter::serveFlush(Uint64 flushRequests)
+{
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_flushesDone = flushRequests;
+    m_drainCv.notify_all();
+}
+
+Uint32
+LogWriter::applyPlacement()
+{
+    // The thread pins itself, so a placement never races with its start or
+    // join
+    Uint32 placements = m_placements;
+    int    cpu        = m_writerCpu;
+    if (cpu >= 0 && !pinCurrentThread(cpu)) {
+        m_writerCpu.compare_exchange_strong(cpu, -1);
+    }
+    return placements;
+}
+
+void
+LogWriter::notify()
+{
+    wakeParked(m_wakeMutex, m_wakeCv, m_parked);
 }
 
 LogWriter::LogWriter()
     : m_thread{}
     , m_logger{ std::make_unique<ConsoleLogger>() } // Default to ConsoleLogger
     , m_running{ false }
-    , m_queue{}
+    , m_queue{ std::make_unique<PerThreadQueue>() }
+    , m_wakeupMode{ WakeupMode::eSpinThenPark }
+    , m_flushIntervalMs{ 0 }
+    , m_spinLimit{ cMinSpinCount }
+    , m_batchSize{ cDefaultBatchSize }
+    , m_maxBatchDelayUs{ 0 }
+    , m_parked{ false }
+    , m_idle{ true }
+    , m_flushRequests{ 0 }
+    , m_flushesDone{ 0 }
+    , m_wakeMutex{}
+    , m_wakeCv{}
+    , m_drainCv{}
+    , m_coalesce{ false }
+    , m_last{ "" }
+    , m_hasLast{ false }
+    , m_repeats{ 0 }
+    , m_repeatsSince{}
+    , m_coalesced{}
+    , m_writerCpu{ writerCpuFromEnv() }
+    , m_placements{ 0 }
+    , m_loggerBytes{ 0 }
+    , m_queueDropped{ 0 }
 {
 }
 
@@ -70,25 +384,111 @@ LogWriter::getLogWriter()
 {
     std::lock_guard<std::mutex> lock(instanceMutex);
     if (!instance) {
-        instance = std::shared_ptr<LogWriter>(new LogWriter());
+        createInstance();
     }
     if (instance->m_running == false)
         instance->start();
     return instance;
 }
 
+LogWriter&
+LogWriter::current()
+{
+    // Released with the thread, or when it next sees a new generation
+    thread_local std::shared_ptr<LogWriter> cached;
+    thread_local Uint64                     cachedGeneration = 0;
+
+    Uint64 latest = generation.load(std::memory_order_acquire);
+    if (latest != cachedGeneration || !cached) {
+        // Read before the instance, a change in between is seen next time
+        cached           = getLogWriter();
+        cachedGeneration = latest;
+    }
+    return *cached;
+}
+
 void
-LogWriter::setLogger(std::unique_ptr<ILogger> logger)
+LogWriter::createInstance()
+{
+    instance = std::shared_ptr<LogWriter>(new LogWriter());
+    generation.fetch_add(1, std::memory_order_release);
+    if (!atExitRegistered) {
+        // Runs before static destructors, while the logger is still usable
+        std::atexit(&LogWriter::shutdown);
+        atExitRegistered = true;
+    }
+}
+
+void
+LogWriter::shutdown()
 {
     std::lock_guard<std::mutex> lock(instanceMutex);
     if (instance) {
-        instance->m_logger = std::move(logger);
-    } else {
-        instance           = std::shared_ptr<LogWriter>(new LogWriter());
-        instance->m_logger = std::move(logger);
+        // stop() only resets the instance if the thread was running
+        auto writer = instance;
+        writer->stop();
+        instance.reset();
+        generation.fetch_add(1, std::memory_order_release);
     }
 }
 
+void
+LogWriter::setLogger(std::unique_ptr<ILogger> logger)
+{
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    if (!instance) {
+        createInstance();
+    }
+    bool wasRunning = instance->m_running;
+    if (wasRunning) {
+        // Pending messages still go to the previous logger
+        instance->stopThread();
+    }
+    instance->m_logger      = std::move(logger);
+    instance->m_loggerBytes = instance->m_logger->getBytesWritten();
+    if (wasRunning) {
+        instance->start();
+    }
+}
+
+void
+LogWriter::setQueue(std::unique_ptr<IQueue> queue)
+{
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    if (!instance) {
+        createInstance();
+    }
+    bool wasRunning = instance->m_running;
+    if (wasRunning) {
+        // Let the thread write out what is pending, then swap underneath it
+        instance->stopThread();
+    }
+    instance->m_queue        = std::move(queue);
+    instance->m_queueDropped = instance->m_queue->getDroppedCount();
+    if (wasRunning) {
+        instance->start();
+    }
+}
+
+void
+LogWriter::setLevel(Priority::PriorityLevel minLevel)
+{
+    level.store(static_cast<Uint32>(minLevel), std::memory_order_relaxed);
+}
+
+void
+LogWriter::setRateLimit(Uint32 perSecond)
+{
+    rateLimit.store(perSecond, std::memory_order_relaxed);
+}
+
+Priority::PriorityLevel
+LogWriter::getLevel()
+{
+    return static_cast<Priority::PriorityLevel>(
+        level.load(std::memory_order_relaxed));
+}
+
 void
 LogWriter::start()
 {
@@ -96,6 +496,7 @@ LogWriter::start()
         return;
     }
     m_running = true;
+    m_idle    = true;
     m_thread  = std::thread(&LogWriter::loggerThread, this);
 }
 
@@ -106,17 +507,41 @@ LogWriter::stop()
         return;
     }
 
-    // Wait for queue to be empty
-    while (!m_queue.empty()) {
-        // Sleep for 0.01 seconds
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    m_running = false;
+    stopThread();
     m_logger->flush();
-    m_thread.join();
 
     instance.reset();
+    generation.fetch_add(1, std::memory_order_release);
+}
+
+void
+LogWriter::stopThread()
+{
+    drain();
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_running = false;
+    }
+    m_wakeCv.notify_one();
+    m_drainCv.notify_all();
+    m_thread.join();
+}
+
+void
+LogWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    if (!m_running) {
+        lock.unlock();
+        m_logger->flush();
+        return;
+    }
+    // Served by the logging thread once it has emptied the queue
+    Uint64 ticket = ++m_flushRequests;
+    m_wakeCv.notify_one();
+    m_drainCv.wait(
+        lock, [&] { return !m_running || m_flushesDone >= ticket; });
 }
 
 LogWriter::~LogWriter()
@@ -127,9 +552,150 @@ LogWriter::~LogWriter()
 void
 LogWriter::log(std::vector<Message>& msgs)
 {
+    bool                                  sample = sampleEnqueue();
+    std::chrono::steady_clock::time_point start{};
+    if (sample) {
+        start = std::chrono::steady_clock::now();
+    }
+
+    size_t count = 0;
     for (auto& msg : msgs) {
-        m_queue.enqueue(msg);
+        m_queue->enqueue(std::move(msg));
+        if (++count % cNotifyInterval == 0) {
+            notify();
+        }
+    }
+    notify();
+
+    if (sample) {
+        recordEnqueue(std::chrono::steady_clock::now() - start, count);
+    }
+}
+
+void
+LogWriter::log(Message&& msg)
+{
+    bool                                  sample = sampleEnqueue();
+    std::chrono::steady_clock::time_point start{};
+    if (sample) {
+        start = std::chrono::steady_clock::now();
+    }
+
+    m_queue->enqueue(std::move(msg));
+    notify();
+
+    if (sample) {
+        recordEnqueue(std::chrono::steady_clock::now() - start, 1);
+    }
+}
+
+void
+LogWriter::drain()
+{
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    if (m_queue->empty() && m_idle) {
+        return;
+    }
+    if (m_parked) {
+        m_wakeCv.notify_one();
+    }
+    // Queue is checked before m_idle, see loggerThread()
+    m_drainCv.wait(lock, [this] {
+        return !m_running || (m_queue->empty() && m_idle);
+    });
+}
+
+void
+LogWriter::setWakeupMode(WakeupMode mode)
+{
+    m_wakeupMode = mode;
+    notify();
+}
+
+void
+LogWriter::setFlushInterval(std::chrono::milliseconds interval)
+{
+    m_flushIntervalMs = interval.count();
+    notify();
+}
+
+void
+LogWriter::setCoalesceRepeats(bool enable)
+{
+    m_coalesce = enable;
+}
+
+void
+LogWriter::setBatchSize(size_t batchSize)
+{
+    m_batchSize = std::max<size_t>(batchSize, 1);
+}
+
+void
+LogWriter::setMaxBatchDelay(std::chrono::microseconds delay)
+{
+    m_maxBatchDelayUs = delay.count();
+}
+
+int
+LogWriter::setPlacement(WriterPlacement placement, int cpu)
+{
+    int chosen  = resolveWriterCpu(placement, cpu);
+    m_writerCpu = chosen;
+    m_placements++;
+    notify();
+    return chosen;
+}
+
+int
+LogWriter::getPlacementCpu() const
+{
+    return m_writerCpu;
+}
+
+Uint64
+LogWriter::getDroppedCount() const
+{
+    return m_queue->getDroppedCount();
+}
+
+void
+LogWriter::visitPending(MessageVisitor visitor, void* ctx)
+{
+    // No lock, may run in a signal handler
+    LogWriter* writer = instance.get();
+    if (writer && writer->m_queue) {
+        writer->m_queue->visitPending(visitor, ctx);
+    }
+    LogManager::visitPending(visitor, ctx);
+}
+
+LogWriterStats
+LogWriter::getStats()
+{
+    auto read = [](const std::atomic<Uint64>& counter) {
+        return counter.load(std::memory_order_relaxed);
+    };
+
+    LogWriterStats stats{};
+    stats.messagesWritten     = read(counters.messagesWritten);
+    stats.messagesDropped     = read(counters.messagesDropped);
+    stats.bytesWritten        = read(counters.bytesWritten);
+    stats.queueDepth          = read(counters.queueDepth);
+    stats.maxQueueDepth       = read(counters.maxQueueDepth);
+    stats.enqueueSamples      = read(counters.enqueueSamples);
+    stats.enqueueLatencyMaxNs = read(counters.enqueueMaxNs);
+    stats.writerBusyNs        = read(counters.writerBusyNs);
+    stats.writerRunNs         = read(counters.writerRunNs);
+    if (stats.enqueueSamples != 0) {
+        stats.enqueueLatencyAvgNs =
+            read(counters.enqueueTotalNs) / stats.enqueueSamples;
+    }
+    if (stats.writerRunNs != 0) {
+        stats.writerUtilization = static_cast<double>(stats.writerBusyNs)
+                                  / static_cast<double>(stats.writerRunNs);
     }
+    return stats;
 }
 
 // Class LogWriter ends
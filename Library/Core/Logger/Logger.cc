@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -28,8 +28,15 @@
 
 #include "Au/Logger/Logger.hh"
 #include <cassert>
+#include <cerrno>
 #include <iostream>
 
+#if defined(_WIN32) || defined(_WIN64)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 namespace Au::Logger {
 
 // Class GenericLogger begins
@@ -63,13 +70,35 @@ GenericLogger::flush()
     assert(false); // Not implemented
 }
 
+Uint64
+GenericLogger::getBytesWritten() const
+{
+    return m_bytesWritten.load(std::memory_order_relaxed);
+}
+
 // Class GenericLogger ends
 
 // Class ConsoleLogger begins
 void
 ConsoleLogger::write(const Message& msg)
 {
-    std::cout << msg.getMsg() << std::endl;
+    String text = msg.getMsg();
+    std::cout << text << std::endl;
+    countBytes(text.size() + 1);
+}
+
+void
+ConsoleLogger::writeBatch(const std::vector<Message>& msgs)
+{
+    m_buffer.clear();
+    for (const auto& msg : msgs) {
+        msg.appendMsg(m_buffer);
+        m_buffer += '\n';
+    }
+    // One flush per batch instead of std::endl per message
+    std::cout.write(m_buffer.data(), m_buffer.size());
+    std::cout.flush();
+    countBytes(m_buffer.size());
 }
 
 String
@@ -108,8 +137,14 @@ DummyLogger::flush()
 
 // Class FileLogger begins
 FileLogger::FileLogger(const String& filename)
+    : FileLogger(filename, "a")
+{
+}
+
+FileLogger::FileLogger(const String& filename, const char* mode)
     : m_filename{ filename }
-    , m_file{ fopen(filename.c_str(), "a") }
+    , m_file{ fopen(filename.c_str(), mode) }
+    , m_buffer{}
 {
     if (m_file == nullptr) {
         std::cerr << "Error opening file: " << filename << std::endl;
@@ -120,7 +155,51 @@ void
 FileLogger::write(const Message& msg)
 {
     if (m_file != nullptr) {
-        fprintf(m_file, "%s\n", msg.getMsg().c_str());
+        String text = msg.getMsg();
+        fprintf(m_file, "%s\n", text.c_str());
+        countBytes(text.size() + 1);
+    }
+}
+
+void
+FileLogger::writeBatch(const std::vector<Message>& msgs)
+{
+    if (m_file == nullptr) {
+        return;
+    }
+    m_buffer.clear();
+    for (const auto& msg : msgs) {
+        msg.appendMsg(m_buffer);
+        m_buffer += '\n';
+    }
+    writeBuffer();
+}
+
+void
+FileLogger::writeBuffer()
+{
+    // Whatever write() left in the stdio buffer goes first
+    fflush(m_file);
+
+    const char* data      = m_buffer.data();
+    size_t      remaining = m_buffer.size();
+    while (remaining > 0) {
+#if defined(_WIN32) || defined(_WIN64)
+        int written = _write(_fileno(m_file),
+                             data,
+                             static_cast<unsigned int>(remaining));
+#else
+        ssize_t written = ::write(fileno(m_file), data, remaining);
+#endif
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            break;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+        countBytes(static_cast<size_t>(written));
     }
 }
 
@@ -157,6 +236,14 @@ LoggerFactory::createLogger(const String& loggerType, const String& loggerName)
         return std::make_unique<DummyLogger>();
     } else if (loggerType == "FileLogger") {
         return std::make_unique<FileLogger>(loggerName);
+    } else if (loggerType == "BinaryFileLogger") {
+        return std::make_unique<BinaryFileLogger>(loggerName);
+    } else if (loggerType == "RotatingFileLogger") {
+        return std::make_unique<RotatingFileLogger>(loggerName);
+    } else if (loggerType == "JsonFileLogger") {
+        return std::make_unique<JsonFileLogger>(loggerName);
+    } else if (loggerType == "MappedFileLogger") {
+        return std::make_unique<MappedFileLogger>(loggerName);
     } else {
         return nullptr;
     }
@@ -167,7 +254,10 @@ void
 LoggerFactory::validateLoggerType(const String& loggerType)
 {
     if (loggerType != "ConsoleLogger" && loggerType != "DummyLogger"
-        && loggerType != "FileLogger") {
+        && loggerType != "FileLogger" && loggerType != "BinaryFileLogger"
+        && loggerType != "RotatingFileLogger"
+        && loggerType != "JsonFileLogger"
+        && loggerType != "MappedFileLogger") {
         throw std::invalid_argument("Invalid logger type");
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -32,6 +32,50 @@ namespace Au::Logger {
 
 thread_local std::vector<Message> LogManager::m_storage;
 
+namespace {
+    // Threads whose storage visitPending() can reach, others are skipped
+    constexpr size_t cMaxStorages = 256;
+
+    std::atomic<std::vector<Message>*> storages[cMaxStorages];
+
+    // Lists a thread's storage in storages while the thread lives
+    class StorageRegistration
+    {
+      public:
+        explicit StorageRegistration(std::vector<Message>* storage)
+            : m_slot{ nullptr }
+        {
+            for (auto& slot : storages) {
+                std::vector<Message>* expected = nullptr;
+                if (slot.compare_exchange_strong(expected, storage)) {
+                    m_slot = &slot;
+                    break;
+                }
+            }
+        }
+
+        StorageRegistration(const StorageRegistration&)            = delete;
+        StorageRegistration& operator=(const StorageRegistration&) = delete;
+
+        ~StorageRegistration()
+        {
+            if (m_slot) {
+                m_slot->store(nullptr, std::memory_order_release);
+            }
+        }
+
+      private:
+        std::atomic<std::vector<Message>*>* m_slot;
+    };
+
+    void listStorage(std::vector<Message>& storage)
+    {
+        // Constructed after storage, so it is unlisted before storage goes
+        // away at thread exit
+        static thread_local StorageRegistration registration{ &storage };
+    }
+} // namespace
+
 LogManager::LogManager(std::shared_ptr<LogWriter> logWriter)
     : m_logWriter{ logWriter }
 {
@@ -40,9 +84,17 @@ LogManager::LogManager(std::shared_ptr<LogWriter> logWriter)
 void
 LogManager::log(Message& msg)
 {
+    listStorage(m_storage);
     m_storage.push_back(msg);
 }
 
+void
+LogManager::log(Message&& msg)
+{
+    listStorage(m_storage);
+    m_storage.push_back(std::move(msg));
+}
+
 void
 LogManager::flush()
 {
@@ -50,6 +102,20 @@ LogManager::flush()
     m_storage.clear();
 }
 
+void
+LogManager::visitPending(MessageVisitor visitor, void* ctx)
+{
+    for (auto& slot : storages) {
+        const std::vector<Message>* storage =
+            slot.load(std::memory_order_acquire);
+        if (storage) {
+            for (const Message& msg : *storage) {
+                visitor(msg, ctx);
+            }
+        }
+    }
+}
+
 LogManager::~LogManager()
 {
     flush();
@@ -62,11 +128,17 @@ LogManager::operator<<(const Message& msg)
     return *this;
 }
 
+LogManager&
+LogManager::operator<<(Message&& msg)
+{
+    log(std::move(msg));
+    return *this;
+}
+
 LogManager&
 LogManager::operator<<(const std::string& msg)
 {
-    Message message(msg);
-    log(message);
+    log(Message(msg));
     return *this;
 }
 
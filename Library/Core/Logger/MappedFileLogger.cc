@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Au/Logger/Logger.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Au::Logger {
+
+namespace {
+    constexpr size_t cCapacityOffset = 8;
+    constexpr size_t cPositionOffset = 16;
+
+    Uint64 loadUint64(const char* src)
+    {
+        Uint64 value = 0;
+        std::memcpy(&value, src, sizeof(value));
+        return value;
+    }
+
+    void storeUint64(char* dst, Uint64 value)
+    {
+        std::memcpy(dst, &value, sizeof(value));
+    }
+} // namespace
+
+// Class MappedFileLogger begins
+MappedFileLogger::MappedFileLogger(const String& filename, Uint64 capacity)
+    : m_filename{ filename }
+    , m_capacity{ capacity }
+    , m_position{ 0 }
+    , m_map{ nullptr }
+    , m_data{ nullptr }
+    , m_buffer{}
+{
+    mapFile();
+}
+
+void
+MappedFileLogger::mapFile()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    std::cerr << "MappedFileLogger is not supported on this platform: "
+              << m_filename << std::endl;
+#else
+    const Uint64 page = static_cast<Uint64>(sysconf(_SC_PAGESIZE));
+    m_capacity = std::max<Uint64>(page, (m_capacity + page - 1) / page * page);
+    const Uint64 total = cHeaderSize + m_capacity;
+
+    int fd = ::open(m_filename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "Error opening file: " << m_filename << std::endl;
+        return;
+    }
+
+    // Continue the ring of an earlier run if it has the same shape
+    bool        reuse = false;
+    struct stat st    = {};
+    if (fstat(fd, &st) == 0 && static_cast<Uint64>(st.st_size) == total) {
+        char header[cPositionOffset + sizeof(Uint64)] = {};
+        reuse = ::pread(fd, header, sizeof(header), 0)
+                    == static_cast<ssize_t>(sizeof(header))
+                && std::memcmp(header, cMagic, sizeof(cMagic)) == 0
+                && loadUint64(header + cCapacityOffset) == m_capacity;
+        if (reuse) {
+            m_position = loadUint64(header + cPositionOffset);
+        }
+    }
+
+    if (!reuse) {
+        int err = ::ftruncate(fd, 0) == 0
+                          && ::ftruncate(fd, static_cast<off_t>(total)) == 0
+                      ? 0
+                      : errno;
+#if defined(__linux__)
+        // Stores into a hole fail with SIGBUS once the disk is full, so
+        // reserve the blocks up front
+        if (err == 0) {
+            err = posix_fallocate(fd, 0, static_cast<off_t>(total));
+            if (err == EINVAL || err == EOPNOTSUPP) {
+                err = 0;
+            }
+        }
+#endif
+        if (err != 0) {
+            std::cerr << "Error sizing file: " << m_filename << std::endl;
+            ::close(fd);
+            return;
+        }
+    }
+
+    void* map = ::mmap(nullptr,
+                       static_cast<size_t>(total),
+                       PROT_READ | PROT_WRITE,
+                       MAP_SHARED,
+                       fd,
+                       0);
+    // The mapping keeps the file open
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        std::cerr << "Error mapping file: " << m_filename << std::endl;
+        return;
+    }
+
+    m_map  = static_cast<char*>(map);
+    m_data = m_map + cHeaderSize;
+    if (!reuse) {
+        storeUint64(m_map + cCapacityOffset, m_capacity);
+        storeUint64(m_map + cPositionOffset, 0);
+        std::memcpy(m_map, cMagic, sizeof(cMagic));
+    }
+#endif
+}
+
+void
+MappedFileLogger::writeBuffer()
+{
+    if (m_data == nullptr || m_buffer.empty()) {
+        m_buffer.clear();
+        return;
+    }
+
+    const char* data  = m_buffer.data();
+    Uint64      bytes = m_buffer.size();
+    countBytes(bytes);
+    if (bytes > m_capacity) {
+        // Only the tail of the batch fits, the rest would be overwritten
+        data += bytes - m_capacity;
+        m_position += bytes - m_capacity;
+        bytes = m_capacity;
+    }
+
+    Uint64 offset = m_position % m_capacity;
+    Uint64 first  = std::min(bytes, m_capacity - offset);
+    std::memcpy(m_data + offset, data, first);
+    std::memcpy(m_data, data + first, bytes - first);
+    m_position += bytes;
+
+    // Readers trust the data before the position they see
+    std::atomic_thread_fence(std::memory_order_release);
+    storeUint64(m_map + cPositionOffset, m_position);
+    m_buffer.clear();
+}
+
+void
+MappedFileLogger::write(const Message& msg)
+{
+    m_buffer.clear();
+    msg.appendMsg(m_buffer);
+    m_buffer += '\n';
+    writeBuffer();
+}
+
+void
+MappedFileLogger::writeBatch(const std::vector<Message>& msgs)
+{
+    m_buffer.clear();
+    for (const auto& msg : msgs) {
+        msg.appendMsg(m_buffer);
+        m_buffer += '\n';
+    }
+    writeBuffer();
+}
+
+void
+MappedFileLogger::flush()
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+    // Only needed to survive a machine crash, schedules write back without
+    // waiting for it
+    if (m_map != nullptr) {
+        ::msync(m_map, static_cast<size_t>(cHeaderSize + m_capacity), MS_ASYNC);
+    }
+#endif
+}
+
+String
+MappedFileLogger::getLoggerType() const
+{
+    return "MappedFileLogger";
+}
+
+Uint64
+MappedFileLogger::getCapacity() const
+{
+    return m_capacity;
+}
+
+bool
+MappedFileLogger::dump(const String& filename, std::ostream& out)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    const String data = contents.str();
+
+    if (data.size() < cHeaderSize
+        || std::memcmp(data.data(), cMagic, sizeof(cMagic)) != 0) {
+        return false;
+    }
+    const Uint64 capacity = loadUint64(data.data() + cCapacityOffset);
+    const Uint64 position = loadUint64(data.data() + cPositionOffset);
+    if (capacity == 0 || data.size() - cHeaderSize < capacity) {
+        return false;
+    }
+
+    const char* ring = data.data() + cHeaderSize;
+    if (position <= capacity) {
+        out.write(ring, static_cast<std::streamsize>(position));
+        return true;
+    }
+
+    // Oldest byte first; the line it starts in was partly overwritten
+    String text(ring + position % capacity, capacity - position % capacity);
+    text.append(ring, position % capacity);
+    size_t start = text.find('\n');
+    start        = start == String::npos ? text.size() : start + 1;
+    out.write(text.data() + start,
+              static_cast<std::streamsize>(text.size() - start));
+    return true;
+}
+
+MappedFileLogger::~MappedFileLogger()
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+    if (m_map != nullptr) {
+        ::munmap(m_map, static_cast<size_t>(cHeaderSize + m_capacity));
+    }
+#endif
+}
+
+// Class MappedFileLogger ends
+} // namespace Au::Logger
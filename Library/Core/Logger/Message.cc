@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -27,9 +27,9 @@
  */
 
 // C++ Standard header files
+#include <charconv>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
+#include <ctime>
 #include <string>
 #include <thread>
 
@@ -39,101 +39,143 @@
 namespace Au::Logger {
 
 // Class Timestamp begins
+namespace {
+    using namespace std::chrono;
+
+    Int64 steadyNow()
+    {
+        return duration_cast<nanoseconds>(
+                   steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    Int64 currentWallOffset()
+    {
+        Int64 steady = steadyNow();
+        Int64 wall =
+            duration_cast<nanoseconds>(system_clock::now().time_since_epoch())
+                .count();
+        return wall - steady;
+    }
+
+    // Wall clock minus steady clock, refreshed by Timestamp::rebase()
+    std::atomic<Int64>& wallOffset()
+    {
+        static std::atomic<Int64> offset{ currentWallOffset() };
+        return offset;
+    }
+
+    // Calendar fields and text of the last second converted by this thread
+    struct SecondCache
+    {
+        Int64   m_second = -1;
+        std::tm m_time   = {};
+        char    m_text[64] = {};
+        size_t  m_length = 0;
+    };
+
+    const SecondCache& lookupSecond(Int64 wallNs)
+    {
+        static thread_local SecondCache cache;
+
+        // Floor, so that times before the epoch land in the right second
+        Int64 second = wallNs / 1000000000;
+        if (wallNs < 0 && wallNs % 1000000000 != 0) {
+            second--;
+        }
+        if (second == cache.m_second) {
+            return cache;
+        }
+
+        std::time_t now_c = static_cast<std::time_t>(second);
+        cache.m_time      = {};
+#if defined(_WIN32) || defined(_WIN64)
+        localtime_s(&cache.m_time, &now_c); // Thread safe on Windows
+#else
+        localtime_r(&now_c, &cache.m_time); // Thread safe on Linux
+#endif
+        cache.m_length = std::strftime(cache.m_text,
+                                       sizeof(cache.m_text),
+                                       "%a %b %d %Y %H:%M:%S",
+                                       &cache.m_time);
+        cache.m_second = second;
+        return cache;
+    }
+} // namespace
+
 Timestamp::Timestamp()
-    : m_now(std::chrono::system_clock::now())
+    : m_ticks{ steadyNow() }
 {
 }
 
+Timestamp::Timestamp(Uint64 nanoseconds)
+    : m_ticks{ static_cast<Int64>(nanoseconds)
+               - wallOffset().load(std::memory_order_relaxed) }
+{
+}
+
+void
+Timestamp::rebase()
+{
+    wallOffset().store(currentWallOffset(), std::memory_order_relaxed);
+}
+
+Int64
+Timestamp::getTicks() const
+{
+    return m_ticks;
+}
+
 String
 Timestamp::getTimestamp() const
 {
-    auto    now_c = std::chrono::system_clock::to_time_t(m_now);
-    std::tm time  = {};
-
-#if defined(_WIN32) || defined(_WIN64)
-    localtime_s(&time, &now_c); // Use localtime_s for thread safety on Windows
-#else
-    localtime_r(&now_c, &time); // Use localtime_r for thread safety on Linux
-#endif
+    String out;
+    appendTimestamp(out);
+    return out;
+}
 
-    std::ostringstream oss{};
-    oss << std::put_time(&time, "%a %b %d %Y %H:%M:%S");
-    return oss.str();
+void
+Timestamp::appendTimestamp(String& out) const
+{
+    const SecondCache& cache = lookupSecond(getNanosecond());
+    out.append(cache.m_text, cache.m_length);
 }
 
 Uint64
 Timestamp::getHour() const
 {
-    auto    now_c = std::chrono::system_clock::to_time_t(m_now);
-    std::tm time  = {};
-
-#if defined(_WIN32) || defined(_WIN64)
-    localtime_s(&time, &now_c); // Use localtime_s for thread safety on Windows
-#else
-    localtime_r(&now_c, &time); // Use localtime_r for thread safety on Linux
-#endif
-
-    return time.tm_hour;
+    return lookupSecond(getNanosecond()).m_time.tm_hour;
 }
 
 Uint64
 Timestamp::getMinute() const
 {
-    auto    now_c = std::chrono::system_clock::to_time_t(m_now);
-    std::tm time  = {};
-
-#if defined(_WIN32) || defined(_WIN64)
-    localtime_s(&time, &now_c); // Use localtime_s for thread safety on Windows
-#else
-    localtime_r(&now_c, &time); // Use localtime_r for thread safety on Linux
-#endif
-
-    return time.tm_min;
+    return lookupSecond(getNanosecond()).m_time.tm_min;
 }
 
 Uint64
 Timestamp::getSecond() const
 {
-    auto    now_c = std::chrono::system_clock::to_time_t(m_now);
-    std::tm time  = {};
-
-#if defined(_WIN32) || defined(_WIN64)
-    localtime_s(&time, &now_c); // Use localtime_s for thread safety on Windows
-#else
-    localtime_r(&now_c, &time); // Use localtime_r for thread safety on Linux
-#endif
-
-    return time.tm_sec;
+    return lookupSecond(getNanosecond()).m_time.tm_sec;
 }
 
 Uint64
 Timestamp::getMillisecond() const
 {
-    // auto now_c = std::chrono::system_clock::to_time_t(m_now);
-    // auto time  = std::localtime(&now_c);
-    return std::chrono::duration_cast<std::chrono::milliseconds>(
-               m_now.time_since_epoch())
-        .count();
+    return getNanosecond() / 1000000;
 }
 
 Uint64
 Timestamp::getMicrosecond() const
 {
-    // auto now_c = std::chrono::system_clock::to_time_t(m_now);
-    // auto time  = std::localtime(&now_c);
-    return std::chrono::duration_cast<std::chrono::microseconds>(
-               m_now.time_since_epoch())
-        .count();
+    return getNanosecond() / 1000;
 }
 
 Uint64
 Timestamp::getNanosecond() const
 {
-    // auto now_c = std::chrono::system_clock::to_time_t(m_now);
-    // auto time  = std::localtime(&now_c);
-    return std::chrono::duration_cast<std::chrono::nanoseconds>(
-               m_now.time_since_epoch())
-        .count();
+    return static_cast<Uint64>(m_ticks
+                               + wallOffset().load(std::memory_order_relaxed));
 }
 
 // Class Timestamp ends
@@ -178,6 +220,12 @@ Priority::toStr() const
     return map->at(this->m_level);
 }
 
+Priority::PriorityLevel
+Priority::getLevel() const
+{
+    return m_level;
+}
+
 // Operator overloads to compare the priority
 bool
 Priority::operator<(const Priority& rhs) const
@@ -218,17 +266,102 @@ Priority::operator!=(const Priority& rhs) const
 // Class Priority ends
 
 // Class Message begins
+namespace {
+    /**
+     * @brief Decodes the key, value pair at pos of encoded fields.
+     */
+    bool nextField(StringView encoded, size_t& pos, Field& field)
+    {
+        ArgType keyType = ArgType::eString;
+        Uint64  bits    = 0;
+        double  real    = 0.0;
+        return decodeArg(encoded, pos, keyType, bits, real, field.key)
+               && keyType == ArgType::eString
+               && decodeArg(
+                   encoded, pos, field.type, field.bits, field.real, field.text);
+    }
+
+    /**
+     * @brief Appends a field value as text, strings with spaces, quotes or
+     * '=' in double quotes.
+     */
+    void appendFieldValue(String& out, const Field& field)
+    {
+        char buf[32];
+        auto put = [&](std::to_chars_result res) {
+            out.append(buf, static_cast<size_t>(res.ptr - buf));
+        };
+        switch (field.type) {
+            case ArgType::eInt64:
+                put(std::to_chars(
+                    buf, buf + sizeof(buf), static_cast<Int64>(field.bits)));
+                break;
+            case ArgType::eUint64:
+                put(std::to_chars(buf, buf + sizeof(buf), field.bits));
+                break;
+            case ArgType::ePointer:
+                out += "0x";
+                put(std::to_chars(buf, buf + sizeof(buf), field.bits, 16));
+                break;
+            case ArgType::eDouble:
+                put(std::to_chars(buf, buf + sizeof(buf), field.real));
+                break;
+            case ArgType::eString:
+                if (field.text.find_first_of(" \"=") == StringView::npos
+                    && !field.text.empty()) {
+                    out += field.text;
+                    break;
+                }
+                out += '"';
+                for (char c : field.text) {
+                    if (c == '"' || c == '\\') {
+                        out += '\\';
+                    }
+                    out += c;
+                }
+                out += '"';
+                break;
+        }
+    }
+} // namespace
 
-Message::Message(const String& msg)
+
+Message::Message(StringView msg)
     : m_msg{ msg }
     , m_priority{ Priority() }
+    , m_formatId{ cNotDeferred }
+    , m_fieldsAt{ static_cast<Uint32>(m_msg.size()) }
+    , m_timestamp{ Timestamp() }
+{
+}
+
+Message::Message(StringView msg, const Priority& priority)
+    : m_msg{ msg }
+    , m_priority{ priority }
+    , m_formatId{ cNotDeferred }
+    , m_fieldsAt{ static_cast<Uint32>(m_msg.size()) }
     , m_timestamp{ Timestamp() }
 {
 }
 
-Message::Message(const String& msg, Priority& priority)
-    : m_msg(msg)
+Message::Message(StringView       msg,
+                 const Priority&  priority,
+                 const Timestamp& timestamp)
+    : m_msg{ msg }
     , m_priority{ priority }
+    , m_formatId{ cNotDeferred }
+    , m_fieldsAt{ static_cast<Uint32>(m_msg.size()) }
+    , m_timestamp{ timestamp }
+{
+}
+
+Message::Message(Uint32          formatId,
+                 MessageBuffer&& args,
+                 const Priority& priority)
+    : m_msg{ std::move(args) }
+    , m_priority{ priority }
+    , m_formatId{ formatId }
+    , m_fieldsAt{ static_cast<Uint32>(m_msg.size()) }
     , m_timestamp{ Timestamp() }
 {
 }
@@ -236,11 +369,109 @@ Message::Message(const String& msg, Priority& priority)
 String
 Message::getMsg() const
 {
-    // Example "Mon Sep 02 2024 11:31:36  : Info : This is a message"
-    std::ostringstream oss;
-    oss << m_timestamp.getTimestamp() << " : " << std::left << std::setw(7)
-        << m_priority.toStr() << " : " << m_msg;
-    return oss.str();
+    String out;
+    appendMsg(out);
+    return out;
+}
+
+void
+Message::appendMsg(String& out) const
+{
+    // Example "Mon Sep 02 2024 11:31:36 : Info    : This is a message"
+    m_timestamp.appendTimestamp(out);
+    out += " : ";
+    String level = m_priority.toStr();
+    out += level;
+    if (level.size() < cLevelWidth) {
+        out.append(cLevelWidth - level.size(), ' ');
+    }
+    out += " : ";
+    if (isDeferred()) {
+        out += getText();
+    } else {
+        out.append(m_msg.data(), m_fieldsAt);
+    }
+
+    StringView fields = getEncodedFields();
+    size_t     pos    = 0;
+    Field      field  = {};
+    while (pos < fields.size() && nextField(fields, pos, field)) {
+        out += ' ';
+        out += field.key;
+        out += '=';
+        appendFieldValue(out, field);
+    }
+}
+
+String
+Message::getText() const
+{
+    if (!isDeferred()) {
+        return String(getPayload());
+    }
+    return formatDeferred(FormatRegistry::get().getFormat(m_formatId),
+                          getPayload());
+}
+
+bool
+Message::isDeferred() const
+{
+    return m_formatId != cNotDeferred;
+}
+
+Uint32
+Message::getFormatId() const
+{
+    return m_formatId;
+}
+
+StringView
+Message::getPayload() const
+{
+    return m_msg.view().substr(0, m_fieldsAt);
+}
+
+bool
+Message::hasSameContent(const Message& other) const
+{
+    return m_priority == other.m_priority && m_formatId == other.m_formatId
+           && m_fieldsAt == other.m_fieldsAt
+           && m_msg.view() == other.m_msg.view();
+}
+
+Message&
+Message::addEncodedFields(StringView fields)
+{
+    m_msg.append(fields.data(), fields.size());
+    return *this;
+}
+
+bool
+Message::hasFields() const
+{
+    return m_fieldsAt < m_msg.size();
+}
+
+StringView
+Message::getEncodedFields() const
+{
+    return m_msg.view().substr(m_fieldsAt);
+}
+
+bool
+Message::getFields(std::vector<Field>& fields) const
+{
+    fields.clear();
+    StringView encoded = getEncodedFields();
+    size_t     pos     = 0;
+    Field      field   = {};
+    while (pos < encoded.size()) {
+        if (!nextField(encoded, pos, field)) {
+            return false;
+        }
+        fields.push_back(field);
+    }
+    return true;
 }
 
 Priority
@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Logger/MessageBuffer.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Au::Logger {
+
+namespace {
+    constexpr size_t cCacheSize = 2 * SlabAllocator::cBlocksPerRefill;
+
+    // Free blocks kept by one thread. Trivially destructible, so it stays
+    // usable while other thread_local objects are destroyed; CacheGuard
+    // empties it and marks it retired instead.
+    struct ThreadCache
+    {
+        char*  m_blocks[SlabAllocator::cClassCount][cCacheSize];
+        size_t m_count[SlabAllocator::cClassCount];
+        bool   m_registered;
+        bool   m_retired;
+    };
+
+    thread_local ThreadCache threadCache;
+
+    struct CacheGuard
+    {
+        ~CacheGuard()
+        {
+            SlabAllocator::get().releaseThreadCache();
+            threadCache.m_retired = true;
+        }
+    };
+
+    /**
+     * @brief Cache of the calling thread, nullptr once the thread is exiting.
+     */
+    ThreadCache* getThreadCache()
+    {
+        if (!threadCache.m_registered) {
+            // Registers the cleanup on first use in this thread
+            static thread_local CacheGuard guard;
+            (void)guard;
+            threadCache.m_registered = true;
+        }
+        return threadCache.m_retired ? nullptr : &threadCache;
+    }
+} // namespace
+
+// Class SlabAllocator begins
+SlabAllocator::SlabAllocator()
+    : m_mutex{}
+    , m_free{}
+    , m_reserved{ 0 }
+{
+}
+
+SlabAllocator&
+SlabAllocator::get()
+{
+    // Never destroyed, messages may be released during exit
+    static SlabAllocator* allocator = new SlabAllocator();
+    return *allocator;
+}
+
+size_t
+SlabAllocator::classOf(size_t size)
+{
+    size_t cls   = 0;
+    size_t block = cMinBlockSize;
+    while (block < size) {
+        block <<= 1;
+        cls++;
+    }
+    return cls;
+}
+
+size_t
+SlabAllocator::takeBlocks(size_t cls, char** out, size_t count)
+{
+    auto& pool = m_free[cls];
+    if (pool.empty()) {
+        const size_t blockSize = cMinBlockSize << cls;
+        char*        chunk     = new char[blockSize * cBlocksPerRefill];
+        m_reserved += blockSize * cBlocksPerRefill;
+        for (size_t i = 0; i < cBlocksPerRefill; i++) {
+            pool.push_back(chunk + i * blockSize);
+        }
+    }
+    size_t taken = std::min(count, pool.size());
+    std::copy(pool.end() - taken, pool.end(), out);
+    pool.resize(pool.size() - taken);
+    return taken;
+}
+
+char*
+SlabAllocator::allocate(size_t size, size_t& capacity)
+{
+    if (size > cMaxBlockSize) {
+        capacity = size;
+        return new char[size];
+    }
+
+    const size_t cls = classOf(size);
+    capacity         = cMinBlockSize << cls;
+    ThreadCache* cache = getThreadCache();
+    if (cache == nullptr) {
+        char*                       block = nullptr;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        takeBlocks(cls, &block, 1);
+        return block;
+    }
+
+    if (cache->m_count[cls] == 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        cache->m_count[cls] =
+            takeBlocks(cls, cache->m_blocks[cls], cBlocksPerRefill);
+    }
+    return cache->m_blocks[cls][--cache->m_count[cls]];
+}
+
+void
+SlabAllocator::deallocate(char* block, size_t capacity)
+{
+    if (capacity > cMaxBlockSize) {
+        delete[] block;
+        return;
+    }
+
+    const size_t cls   = classOf(capacity);
+    ThreadCache* cache = getThreadCache();
+    if (cache == nullptr) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free[cls].push_back(block);
+        return;
+    }
+
+    if (cache->m_count[cls] == cCacheSize) {
+        // Hand half of the cache to the threads that allocate
+        std::lock_guard<std::mutex> lock(m_mutex);
+        char** first = cache->m_blocks[cls] + cCacheSize - cBlocksPerRefill;
+        m_free[cls].insert(m_free[cls].end(), first, first + cBlocksPerRefill);
+        cache->m_count[cls] -= cBlocksPerRefill;
+    }
+    cache->m_blocks[cls][cache->m_count[cls]++] = block;
+}
+
+Uint64
+SlabAllocator::getReservedBytes()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_reserved;
+}
+
+void
+SlabAllocator::releaseThreadCache()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t cls = 0; cls < cClassCount; cls++) {
+        char** first = threadCache.m_blocks[cls];
+        m_free[cls].insert(
+            m_free[cls].end(), first, first + threadCache.m_count[cls]);
+        threadCache.m_count[cls] = 0;
+    }
+}
+// Class SlabAllocator ends
+
+// Class MessageBuffer begins
+MessageBuffer::MessageBuffer()
+    : m_data{ m_inline }
+    , m_size{ 0 }
+    , m_capacity{ cInlineCapacity }
+{
+}
+
+MessageBuffer::MessageBuffer(StringView text)
+    : MessageBuffer()
+{
+    append(text.data(), text.size());
+}
+
+MessageBuffer::MessageBuffer(const MessageBuffer& other)
+    : MessageBuffer()
+{
+    append(other.m_data, other.m_size);
+}
+
+MessageBuffer::MessageBuffer(MessageBuffer&& other) noexcept
+    : MessageBuffer()
+{
+    *this = std::move(other);
+}
+
+MessageBuffer&
+MessageBuffer::operator=(const MessageBuffer& other)
+{
+    if (this != &other) {
+        clear();
+        append(other.m_data, other.m_size);
+    }
+    return *this;
+}
+
+MessageBuffer&
+MessageBuffer::operator=(MessageBuffer&& other) noexcept
+{
+    if (this == &other) {
+        return *this;
+    }
+    release();
+    if (other.isInline()) {
+        std::memcpy(m_inline, other.m_inline, other.m_size);
+    } else {
+        // Take over the block
+        m_data         = other.m_data;
+        m_capacity     = other.m_capacity;
+        other.m_data     = other.m_inline;
+        other.m_capacity = cInlineCapacity;
+    }
+    m_size       = other.m_size;
+    other.m_size = 0;
+    return *this;
+}
+
+MessageBuffer::~MessageBuffer()
+{
+    release();
+}
+
+void
+MessageBuffer::append(const char* data, size_t size)
+{
+    if (m_size + size > m_capacity) {
+        grow(std::max<size_t>(m_size + size, 2 * m_capacity));
+    }
+    std::memcpy(m_data + m_size, data, size);
+    m_size += static_cast<Uint32>(size);
+}
+
+void
+MessageBuffer::reserve(size_t size)
+{
+    if (size > m_capacity) {
+        grow(size);
+    }
+}
+
+void
+MessageBuffer::grow(size_t size)
+{
+    size_t capacity = 0;
+    char*  block    = SlabAllocator::get().allocate(size, capacity);
+    std::memcpy(block, m_data, m_size);
+    Uint32 used = m_size;
+    release();
+    m_data     = block;
+    m_capacity = static_cast<Uint32>(capacity);
+    m_size     = used;
+}
+
+void
+MessageBuffer::release()
+{
+    if (!isInline()) {
+        SlabAllocator::get().deallocate(m_data, m_capacity);
+        m_data     = m_inline;
+        m_capacity = cInlineCapacity;
+    }
+    m_size = 0;
+}
+// Class MessageBuffer ends
+} // namespace Au::Logger
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Au/Types.hh"
+
+namespace Au::Logger {
+
+/**
+ * @brief Spin phase of a thread waiting for work, yields between checks.
+ * @param count Number of checks.
+ * @param hasWork Predicate telling whether there is work.
+ * @return true if hasWork() became true, false if the thread should park.
+ */
+template<typename HasWork>
+bool
+spinFor(Uint32 count, HasWork hasWork)
+{
+    for (Uint32 spin = 0; spin < count; spin++) {
+        if (hasWork()) {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+    return false;
+}
+
+/**
+ * @brief Park phase of a thread waiting for work, sleeps on cv until
+ * hasWork() or the timeout. Raises parked and issues a full fence before
+ * checking hasWork(), pairing with the fence in wakeParked(): either the
+ * producer sees the thread parked or the thread sees the work.
+ * @param mutex Mutex of cv.
+ * @param cv Condition variable producers signal.
+ * @param parked Set while the thread sleeps.
+ * @param timeout Longest sleep, guards against a missed wakeup.
+ * @param hasWork Predicate telling whether there is work.
+ */
+template<typename HasWork>
+void
+parkFor(std::mutex&               mutex,
+        std::condition_variable&  cv,
+        std::atomic<bool>&        parked,
+        std::chrono::milliseconds timeout,
+        HasWork                   hasWork)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    parked = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    cv.wait_for(lock, timeout, hasWork);
+    parked = false;
+}
+
+/**
+ * @brief Wakes a thread sleeping in parkFor(), called after publishing
+ * work. Takes the mutex only if the thread is parked.
+ * @param mutex Mutex of cv.
+ * @param cv Condition variable the thread sleeps on.
+ * @param parked Flag raised by parkFor().
+ */
+inline void
+wakeParked(std::mutex&              mutex,
+           std::condition_variable& cv,
+           const std::atomic<bool>& parked)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_one();
+    }
+}
+
+} // namespace Au::Logger
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -28,6 +28,9 @@
 
 #include "Au/Logger/Queue.hh"
 
+#include <algorithm>
+#include <thread>
+
 namespace Au::Logger {
 
 // Class LockingQueue begins
@@ -44,6 +47,13 @@ LockingQueue::enqueue(const Message& msg)
     m_queue.push_back(msg);
 }
 
+void
+LockingQueue::enqueue(Message&& msg)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.push_back(std::move(msg));
+}
+
 Message
 LockingQueue::dequeue()
 {
@@ -56,6 +66,18 @@ LockingQueue::dequeue()
     return msg;
 }
 
+bool
+LockingQueue::tryDequeue(Message& msg)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_queue.empty()) {
+        return false;
+    }
+    msg = std::move(m_queue.front());
+    m_queue.pop_front();
+    return true;
+}
+
 bool
 LockingQueue::empty()
 {
@@ -69,5 +91,478 @@ LockingQueue::getCount()
     std::lock_guard<std::mutex> lock(m_mutex);
     return m_queue.size();
 }
+
+Uint64
+LockingQueue::getDroppedCount()
+{
+    // Unbounded, never drops
+    return 0;
+}
+
+void
+LockingQueue::visitPending(MessageVisitor visitor, void* ctx)
+{
+    // No lock, the crashing thread may be holding it
+    for (const Message& msg : m_queue) {
+        visitor(msg, ctx);
+    }
+}
 // Class LockingQueue ends
+
+// Class RingQueue begins
+namespace {
+    size_t roundUpPow2(size_t value)
+    {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+} // namespace
+
+RingQueue::RingQueue(size_t capacity, OverflowPolicy policy)
+    : m_mask{ roundUpPow2(capacity) - 1 }
+    , m_policy{ policy }
+    , m_slots{ std::make_unique<Slot[]>(m_mask + 1) }
+    , m_head{ 0 }
+    , m_tail{ 0 }
+    , m_dropped{ 0 }
+{
+    for (Uint64 i = 0; i <= m_mask; i++) {
+        m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool
+RingQueue::tryEnqueue(Message&& msg)
+{
+    Uint64 pos = m_tail.load(std::memory_order_relaxed);
+    Slot*  slot;
+    for (;;) {
+        slot       = &m_slots[pos & m_mask];
+        Uint64 seq = slot->m_sequence.load(std::memory_order_acquire);
+        Int64  diff = static_cast<Int64>(seq) - static_cast<Int64>(pos);
+        if (diff == 0) {
+            // Slot is free for this lap, try to claim it
+            if (m_tail.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Consumer has not released this slot yet, queue is full
+            return false;
+        } else {
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+    slot->m_msg.emplace(std::move(msg));
+    slot->m_sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool
+RingQueue::tryPop(std::optional<Message>& msg)
+{
+    // The LogWriter thread is the only regular consumer, but with
+    // eDropOldest a producer may evict the oldest slot as well, so the
+    // head still has to be claimed with a CAS.
+    Uint64 pos = m_head.load(std::memory_order_relaxed);
+    Slot*  slot;
+    for (;;) {
+        slot       = &m_slots[pos & m_mask];
+        Uint64 seq = slot->m_sequence.load(std::memory_order_acquire);
+        Int64  diff = static_cast<Int64>(seq) - static_cast<Int64>(pos + 1);
+        if (diff == 0) {
+            // Release, so that a reader seeing the queue empty also sees
+            // what the consumer did before taking the message
+            if (m_head.compare_exchange_weak(pos,
+                                             pos + 1,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Nothing published at the head yet
+            return false;
+        } else {
+            pos = m_head.load(std::memory_order_relaxed);
+        }
+    }
+    msg = std::move(slot->m_msg);
+    slot->m_msg.reset();
+    slot->m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+    return true;
+}
+
+void
+RingQueue::enqueue(const Message& msg)
+{
+    enqueue(Message(msg));
+}
+
+void
+RingQueue::enqueue(Message&& msg)
+{
+    while (!tryEnqueue(std::move(msg))) {
+        switch (m_policy) {
+            case OverflowPolicy::eDropNewest:
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            case OverflowPolicy::eDropOldest: {
+                std::optional<Message> victim{};
+                if (tryPop(victim)) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                break;
+            }
+            case OverflowPolicy::eBlock:
+            default:
+                std::this_thread::yield();
+                break;
+        }
+    }
+}
+
+Message
+RingQueue::dequeue()
+{
+    std::optional<Message> msg{};
+    if (!tryPop(msg)) {
+        return Message("Empty Queue");
+    }
+    return std::move(*msg);
+}
+
+bool
+RingQueue::tryDequeue(Message& msg)
+{
+    std::optional<Message> popped{};
+    if (!tryPop(popped)) {
+        return false;
+    }
+    msg = std::move(*popped);
+    return true;
+}
+
+bool
+RingQueue::empty()
+{
+    return getCount() == 0;
+}
+
+Uint64
+RingQueue::getCount()
+{
+    // Includes slots claimed by producers but not yet published
+    Uint64 head = m_head.load(std::memory_order_acquire);
+    Uint64 tail = m_tail.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+Uint64
+RingQueue::getDroppedCount()
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+void
+RingQueue::visitPending(MessageVisitor visitor, void* ctx)
+{
+    Uint64 head = m_head.load(std::memory_order_acquire);
+    Uint64 tail = m_tail.load(std::memory_order_acquire);
+    for (Uint64 pos = head; pos != tail && pos - head <= m_mask; pos++) {
+        const Slot& slot = m_slots[pos & m_mask];
+        // Skip slots claimed but not published yet
+        if (slot.m_sequence.load(std::memory_order_acquire) == pos + 1
+            && slot.m_msg) {
+            visitor(*slot.m_msg, ctx);
+        }
+    }
+}
+
+size_t
+RingQueue::getCapacity() const
+{
+    return m_mask + 1;
+}
+
+OverflowPolicy
+RingQueue::getOverflowPolicy() const
+{
+    return m_policy;
+}
+// Class RingQueue ends
+
+// Class PerThreadQueue begins
+namespace {
+    // Ids are never reused, a thread may still hold a buffer of a queue that
+    // has been destroyed
+    std::atomic<Uint64> nextQueueId{ 1 };
+    // Messages taken from one buffer before moving on to the next
+    constexpr size_t cMaxBurst = 64;
+} // namespace
+
+struct PerThreadQueue::Buffer
+{
+    explicit Buffer(size_t capacity)
+        : m_mask{ capacity - 1 }
+        , m_slots{ std::make_unique<std::optional<Message>[]>(capacity) }
+        , m_retired{ false }
+        , m_orphaned{ false }
+        , m_head{ 0 }
+        , m_tail{ 0 }
+    {
+    }
+
+    Uint64 getCount() const
+    {
+        // Head first, it never passes the tail
+        Uint64 head = m_head.load(std::memory_order_acquire);
+        return m_tail.load(std::memory_order_acquire) - head;
+    }
+
+    const Uint64                              m_mask;
+    std::unique_ptr<std::optional<Message>[]> m_slots;
+    std::atomic<bool> m_retired;  ///< Producer thread has exited
+    std::atomic<bool> m_orphaned; ///< Queue has been destroyed
+
+    alignas(cCacheLineSize) std::atomic<Uint64> m_head; ///< Consumer index
+    alignas(cCacheLineSize) std::atomic<Uint64> m_tail; ///< Producer index
+};
+
+PerThreadQueue::PerThreadQueue(size_t capacity, OverflowPolicy policy)
+    : m_id{ nextQueueId.fetch_add(1, std::memory_order_relaxed) }
+    , m_capacity{ roundUpPow2(capacity) }
+    , m_policy{ policy }
+    , m_mutex{}
+    , m_buffers{}
+    , m_version{ 0 }
+    , m_active{}
+    , m_activeVersion{ 0 }
+    , m_next{ 0 }
+    , m_burst{ 0 }
+    , m_dropped{ 0 }
+{
+}
+
+PerThreadQueue::~PerThreadQueue()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& buffer : m_buffers) {
+        buffer->m_orphaned.store(true, std::memory_order_release);
+    }
+}
+
+PerThreadQueue::Buffer&
+PerThreadQueue::getBuffer()
+{
+    // Buffers this thread has registered, retired when the thread exits
+    struct Registrations
+    {
+        std::vector<std::pair<Uint64, std::shared_ptr<Buffer>>> m_list;
+
+        Registrations()
+            : m_list{}
+        {
+        }
+
+        ~Registrations()
+        {
+            for (auto& entry : m_list) {
+                entry.second->m_retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+    static thread_local Registrations registrations;
+
+    auto& list = registrations.m_list;
+    for (auto& entry : list) {
+        if (entry.first == m_id) {
+            return *entry.second;
+        }
+    }
+
+    // First message from this thread, forget buffers of destroyed queues
+    list.erase(std::remove_if(list.begin(),
+                              list.end(),
+                              [](const auto& entry) {
+                                  return entry.second->m_orphaned.load(
+                                      std::memory_order_acquire);
+                              }),
+               list.end());
+
+    auto buffer = std::make_shared<Buffer>(m_capacity);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_buffers.push_back(buffer);
+        m_version.fetch_add(1, std::memory_order_release);
+    }
+    list.emplace_back(m_id, buffer);
+    return *buffer;
+}
+
+void
+PerThreadQueue::refreshBuffers(bool releaseRetired)
+{
+    bool retiring = false;
+    if (releaseRetired) {
+        for (auto& buffer : m_active) {
+            if (buffer->m_retired.load(std::memory_order_acquire)) {
+                retiring = true;
+                break;
+            }
+        }
+    }
+    if (!retiring
+        && m_version.load(std::memory_order_acquire) == m_activeVersion) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (retiring) {
+        // Retired is set after the thread's last message, so an empty retired
+        // buffer stays empty
+        m_buffers.erase(
+            std::remove_if(m_buffers.begin(),
+                           m_buffers.end(),
+                           [](const std::shared_ptr<Buffer>& buffer) {
+                               return buffer->m_retired.load(
+                                          std::memory_order_acquire)
+                                      && buffer->getCount() == 0;
+                           }),
+            m_buffers.end());
+        m_version.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_active        = m_buffers;
+    m_activeVersion = m_version.load(std::memory_order_relaxed);
+    m_next          = 0;
+    m_burst         = 0;
+}
+
+void
+PerThreadQueue::enqueue(const Message& msg)
+{
+    enqueue(Message(msg));
+}
+
+void
+PerThreadQueue::enqueue(Message&& msg)
+{
+    Buffer& buffer = getBuffer();
+    // Only this thread writes the tail
+    Uint64 tail = buffer.m_tail.load(std::memory_order_relaxed);
+    while (tail - buffer.m_head.load(std::memory_order_acquire)
+           > buffer.m_mask) {
+        if (m_policy != OverflowPolicy::eBlock) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::this_thread::yield();
+    }
+    buffer.m_slots[tail & buffer.m_mask].emplace(std::move(msg));
+    buffer.m_tail.store(tail + 1, std::memory_order_release);
+}
+
+bool
+PerThreadQueue::tryDequeue(Message& msg)
+{
+    refreshBuffers(false);
+    if (tryPop(msg)) {
+        return true;
+    }
+    // Everything looked empty, a good time to let go of exited threads
+    refreshBuffers(true);
+    return tryPop(msg);
+}
+
+bool
+PerThreadQueue::tryPop(Message& msg)
+{
+    const size_t count = m_active.size();
+    for (size_t i = 0; i < count; i++) {
+        if (m_burst >= cMaxBurst) {
+            m_next  = (m_next + 1) % count;
+            m_burst = 0;
+        }
+        Buffer& buffer = *m_active[m_next];
+        Uint64  head   = buffer.m_head.load(std::memory_order_relaxed);
+        if (head == buffer.m_tail.load(std::memory_order_acquire)) {
+            m_next  = (m_next + 1) % count;
+            m_burst = 0;
+            continue;
+        }
+        auto& slot = buffer.m_slots[head & buffer.m_mask];
+        msg        = std::move(*slot);
+        slot.reset();
+        // Release, so that a reader seeing the queue empty also sees what
+        // the consumer did before taking the message
+        buffer.m_head.store(head + 1, std::memory_order_release);
+        m_burst++;
+        return true;
+    }
+    return false;
+}
+
+Message
+PerThreadQueue::dequeue()
+{
+    Message msg("Empty Queue");
+    tryDequeue(msg);
+    return msg;
+}
+
+bool
+PerThreadQueue::empty()
+{
+    return getCount() == 0;
+}
+
+Uint64
+PerThreadQueue::getCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Uint64                      count = 0;
+    for (auto& buffer : m_buffers) {
+        count += buffer->getCount();
+    }
+    return count;
+}
+
+Uint64
+PerThreadQueue::getDroppedCount()
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+void
+PerThreadQueue::visitPending(MessageVisitor visitor, void* ctx)
+{
+    // No lock, the crashing thread may be holding it
+    for (auto& buffer : m_buffers) {
+        Uint64 head = buffer->m_head.load(std::memory_order_acquire);
+        Uint64 tail = buffer->m_tail.load(std::memory_order_acquire);
+        for (Uint64 pos = head; pos != tail && pos - head <= buffer->m_mask;
+             pos++) {
+            const auto& slot = buffer->m_slots[pos & buffer->m_mask];
+            if (slot) {
+                visitor(*slot, ctx);
+            }
+        }
+    }
+}
+
+size_t
+PerThreadQueue::getCapacity() const
+{
+    return m_capacity;
+}
+
+size_t
+PerThreadQueue::getBufferCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_buffers.size();
+}
+// Class PerThreadQueue ends
 } // namespace Au::Logger
@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Au/Logger/Logger.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+#include <fcntl.h>
+#if defined(_WIN32) || defined(_WIN64)
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Au::Logger {
+
+namespace {
+    namespace fs = std::filesystem;
+
+    /**
+     * @brief Parses the number of a rotated file, "<base>.<n>" optionally
+     * followed by a suffix such as ".gz".
+     * @return true if name is a rotated file of base.
+     */
+    bool parseSequence(const String& name, const String& base, Uint64& seq)
+    {
+        if (name.size() <= base.size() + 1
+            || name.compare(0, base.size(), base) != 0
+            || name[base.size()] != '.') {
+            return false;
+        }
+        size_t pos    = base.size() + 1;
+        size_t digits = 0;
+        seq           = 0;
+        while (pos < name.size() && name[pos] >= '0' && name[pos] <= '9') {
+            seq = seq * 10 + static_cast<Uint64>(name[pos] - '0');
+            pos++;
+            digits++;
+        }
+        return digits > 0 && (pos == name.size() || name[pos] == '.');
+    }
+
+    /**
+     * @brief Calls fn(path, seq) for every rotated file of filename.
+     */
+    template<typename Fn>
+    void forEachRotated(const String& filename, Fn&& fn)
+    {
+        fs::path        path(filename);
+        fs::path        dir = path.has_parent_path() ? path.parent_path() : ".";
+        String          base = path.filename().string();
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator(dir, ec)) {
+            Uint64 seq = 0;
+            if (parseSequence(entry.path().filename().string(), base, seq)) {
+                fn(entry.path(), seq);
+            }
+        }
+    }
+} // namespace
+
+// Class RotatingFileLogger begins
+RotatingFileLogger::RotatingFileLogger(const String&         filename,
+                                       const RotationPolicy& policy)
+    : m_filename{ filename }
+    , m_policy{ policy }
+    , m_fd{ -1 }
+    , m_size{ 0 }
+    , m_sequence{ 0 }
+    , m_openedAt{}
+    , m_buffer{}
+    , m_housekeeper{}
+    , m_mutex{}
+    , m_cv{}
+    , m_rotated{}
+    , m_busy{ false }
+    , m_stopping{ false }
+{
+    // Continue numbering after files left by an earlier run
+    forEachRotated(m_filename, [this](const fs::path&, Uint64 seq) {
+        m_sequence = std::max(m_sequence, seq);
+    });
+    openFile();
+    m_housekeeper = std::thread(&RotatingFileLogger::housekeeping, this);
+}
+
+void
+RotatingFileLogger::openFile()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    m_fd = _open(m_filename.c_str(),
+                 _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY,
+                 _S_IREAD | _S_IWRITE);
+#else
+    m_fd = ::open(m_filename.c_str(),
+                  O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+                  0644);
+#endif
+    m_openedAt = std::chrono::steady_clock::now();
+    m_size     = 0;
+    if (m_fd < 0) {
+        std::cerr << "Error opening file: " << m_filename << std::endl;
+        return;
+    }
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    struct stat st = {};
+    if (fstat(m_fd, &st) == 0) {
+        m_size = static_cast<Uint64>(st.st_size);
+    }
+#if defined(__linux__)
+    if (m_policy.preallocate && m_policy.maxFileSize > m_size) {
+        // Keeps the file size, only reserves the blocks. Best effort, not
+        // every file system supports it.
+        (void)fallocate(m_fd,
+                        FALLOC_FL_KEEP_SIZE,
+                        static_cast<off_t>(m_size),
+                        static_cast<off_t>(m_policy.maxFileSize - m_size));
+    }
+#endif
+#else
+    m_size = static_cast<Uint64>(_filelengthi64(m_fd));
+#endif
+}
+
+bool
+RotatingFileLogger::needsRotation(size_t pending, size_t bytes) const
+{
+    Uint64 used = m_size + pending;
+    if (used == 0) {
+        // Never leave an empty file behind, even for oversized messages
+        return false;
+    }
+    if (m_policy.maxFileSize > 0 && used + bytes > m_policy.maxFileSize) {
+        return true;
+    }
+    return m_policy.maxFileAge.count() > 0
+           && std::chrono::steady_clock::now() - m_openedAt
+                  >= m_policy.maxFileAge;
+}
+
+void
+RotatingFileLogger::rotate()
+{
+    if (m_fd >= 0) {
+#if defined(_WIN32) || defined(_WIN64)
+        _close(m_fd);
+#else
+        ::close(m_fd);
+#endif
+        m_fd = -1;
+    }
+
+    // A single rename on the logging thread, the rest is housekeeping
+    Uint64 seq     = m_sequence + 1;
+    String rotated = m_filename + "." + std::to_string(seq);
+    if (std::rename(m_filename.c_str(), rotated.c_str()) == 0) {
+        m_sequence = seq;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_rotated.emplace_back(seq, std::move(rotated));
+        }
+        // waitForHousekeeping() waits on m_cv as well, notify_one() could
+        // wake it instead of the housekeeping thread
+        m_cv.notify_all();
+    }
+    openFile();
+}
+
+void
+RotatingFileLogger::writeBuffer()
+{
+    const char* data      = m_buffer.data();
+    size_t      remaining = m_buffer.size();
+    while (m_fd >= 0 && remaining > 0) {
+#if defined(_WIN32) || defined(_WIN64)
+        int written =
+            _write(m_fd, data, static_cast<unsigned int>(remaining));
+#else
+        ssize_t written = ::write(m_fd, data, remaining);
+#endif
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            break;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+        m_size += static_cast<Uint64>(written);
+        countBytes(static_cast<size_t>(written));
+    }
+    m_buffer.clear();
+}
+
+void
+RotatingFileLogger::appendLine(const Message& msg)
+{
+    size_t start = m_buffer.size();
+    msg.appendMsg(m_buffer);
+    m_buffer += '\n';
+
+    // Everything before this message goes to the current file
+    if (needsRotation(start, m_buffer.size() - start)) {
+        String line = m_buffer.substr(start);
+        m_buffer.resize(start);
+        writeBuffer();
+        rotate();
+        m_buffer = std::move(line);
+    }
+}
+
+void
+RotatingFileLogger::write(const Message& msg)
+{
+    m_buffer.clear();
+    appendLine(msg);
+    writeBuffer();
+}
+
+void
+RotatingFileLogger::writeBatch(const std::vector<Message>& msgs)
+{
+    m_buffer.clear();
+    for (const auto& msg : msgs) {
+        appendLine(msg);
+    }
+    writeBuffer();
+}
+
+void
+RotatingFileLogger::flush()
+{
+    // Nothing is buffered in user space, write() hands data to the kernel
+}
+
+String
+RotatingFileLogger::getLoggerType() const
+{
+    return "RotatingFileLogger";
+}
+
+void
+RotatingFileLogger::housekeeping()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_cv.wait(lock, [this] { return m_stopping || !m_rotated.empty(); });
+        if (m_rotated.empty()) {
+            return;
+        }
+        auto rotated = std::move(m_rotated.front());
+        m_rotated.pop_front();
+        m_busy = true;
+        lock.unlock();
+
+        if (m_policy.onRotated) {
+            m_policy.onRotated(rotated.second);
+        }
+        removeExpired(rotated.first);
+
+        lock.lock();
+        m_busy = false;
+        m_cv.notify_all();
+    }
+}
+
+void
+RotatingFileLogger::removeExpired(Uint64 newest)
+{
+    if (m_policy.maxFiles == 0 || newest <= m_policy.maxFiles) {
+        return;
+    }
+    const Uint64 oldestKept = newest - m_policy.maxFiles + 1;
+    forEachRotated(m_filename, [oldestKept](const fs::path& path, Uint64 seq) {
+        if (seq < oldestKept) {
+            std::error_code ec;
+            fs::remove(path, ec);
+        }
+    });
+}
+
+void
+RotatingFileLogger::waitForHousekeeping()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] { return m_rotated.empty() && !m_busy; });
+}
+
+RotatingFileLogger::~RotatingFileLogger()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cv.notify_all();
+    // Finishes the files already queued
+    if (m_housekeeper.joinable()) {
+        m_housekeeper.join();
+    }
+    if (m_fd >= 0) {
+#if defined(_WIN32) || defined(_WIN64)
+        _close(m_fd);
+#else
+        ::close(m_fd);
+#endif
+    }
+}
+
+// Class RotatingFileLogger ends
+} // namespace Au::Logger
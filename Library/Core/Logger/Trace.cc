@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Logger/Trace.hh"
+#include "Json.hh"
+
+#include <algorithm>
+#include <fstream>
+#include <ostream>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Au::Logger {
+
+std::atomic<bool> Tracer::enabled{ false };
+
+namespace {
+    constexpr size_t cMaxBlocks = Tracer::cMaxEvents / Tracer::cBlockEvents;
+
+    Uint64 processId()
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        return static_cast<Uint64>(_getpid());
+#else
+        return static_cast<Uint64>(getpid());
+#endif
+    }
+} // namespace
+
+/**
+ * @brief Spans of one thread. Only the owning thread appends; readers see
+ * the events below m_count, published with release semantics. Once the
+ * thread has exited and its spans were exported the buffer is handed to the
+ * next new thread.
+ */
+struct Tracer::Buffer
+{
+    struct Block
+    {
+        TraceEvent events[cBlockEvents];
+    };
+
+    std::atomic<Block*> m_blocks[cMaxBlocks]; ///< Allocated as needed
+    std::atomic<Uint64> m_count;              ///< Events recorded
+    std::atomic<Uint64> m_dropped;            ///< Events past cMaxEvents
+    Uint32              m_thread;             ///< Thread number, from 1
+    bool                m_exited;   ///< Owner has exited, under m_mutex
+    Uint64              m_exported; ///< m_count at the last getEvents()
+
+    explicit Buffer(Uint32 thread)
+        : m_blocks{}
+        , m_count{ 0 }
+        , m_dropped{ 0 }
+        , m_thread{ thread }
+        , m_exited{ false }
+        , m_exported{ 0 }
+    {
+    }
+
+    Buffer(const Buffer&)            = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    ~Buffer()
+    {
+        for (auto& block : m_blocks) {
+            delete block.load(std::memory_order_relaxed);
+        }
+    }
+
+    void append(const char* name, Uint64 begin, Uint64 end)
+    {
+        Uint64 index = m_count.load(std::memory_order_relaxed);
+        if (index >= cMaxEvents) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        auto&  slot  = m_blocks[index / cBlockEvents];
+        Block* block = slot.load(std::memory_order_relaxed);
+        if (block == nullptr) {
+            block = new Block;
+            slot.store(block, std::memory_order_release);
+        }
+        block->events[index % cBlockEvents] = TraceEvent{ name, begin, end };
+        m_count.store(index + 1, std::memory_order_release);
+    }
+
+    const TraceEvent& at(Uint64 index) const
+    {
+        return m_blocks[index / cBlockEvents]
+            .load(std::memory_order_acquire)
+            ->events[index % cBlockEvents];
+    }
+};
+
+// Class Tracer begins
+Tracer::Tracer()
+    : m_mutex{}
+    , m_buffers{}
+    , m_threads{ 0 }
+    , m_startTicks{ now() }
+    , m_startTime{ std::chrono::steady_clock::now() }
+{
+}
+
+Tracer&
+Tracer::get()
+{
+    // Never destroyed, threads may record while the process exits
+    static Tracer* tracer = new Tracer();
+    return *tracer;
+}
+
+void
+Tracer::setEnabled(bool enable)
+{
+    if (enable) {
+        get(); // Starts the clock before the first span
+    }
+    enabled.store(enable, std::memory_order_relaxed);
+}
+
+Tracer::Buffer*
+Tracer::addBuffer()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Uint32                      thread = ++m_threads;
+    for (auto& buffer : m_buffers) {
+        // Reuse the buffer of an exited thread whose spans were exported
+        if (buffer->m_exited
+            && buffer->m_exported
+                   == buffer->m_count.load(std::memory_order_relaxed)) {
+            buffer->m_count.store(0, std::memory_order_relaxed);
+            buffer->m_dropped.store(0, std::memory_order_relaxed);
+            buffer->m_thread   = thread;
+            buffer->m_exited   = false;
+            buffer->m_exported = 0;
+            return buffer.get();
+        }
+    }
+    m_buffers.push_back(std::make_unique<Buffer>(thread));
+    return m_buffers.back().get();
+}
+
+void
+Tracer::releaseBuffer(Buffer* buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (buffer->m_count.load(std::memory_order_relaxed) != 0) {
+        // Kept for export, reused or freed afterwards
+        buffer->m_exited = true;
+        return;
+    }
+    for (auto it = m_buffers.begin(); it != m_buffers.end(); ++it) {
+        if (it->get() == buffer) {
+            m_buffers.erase(it);
+            break;
+        }
+    }
+}
+
+void
+Tracer::record(const char* name, Uint64 begin, Uint64 end)
+{
+    // Gives the buffer back to the tracer when the thread exits
+    struct Owner
+    {
+        Buffer* m_buffer;
+
+        Owner()
+            : m_buffer{ nullptr }
+        {
+        }
+        Owner(const Owner&)            = delete;
+        Owner& operator=(const Owner&) = delete;
+        ~Owner()
+        {
+            if (m_buffer != nullptr) {
+                get().releaseBuffer(m_buffer);
+            }
+        }
+    };
+
+    thread_local Owner owner;
+    if (owner.m_buffer == nullptr) {
+        owner.m_buffer = get().addBuffer();
+    }
+    owner.m_buffer->append(name, begin, end);
+}
+
+size_t
+Tracer::getEventCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t                      count = 0;
+    for (auto& buffer : m_buffers) {
+        count += buffer->m_count.load(std::memory_order_acquire);
+    }
+    return count;
+}
+
+Uint64
+Tracer::getDroppedCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Uint64                      dropped = 0;
+    for (auto& buffer : m_buffers) {
+        dropped += buffer->m_dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+void
+Tracer::getEvents(std::vector<TraceEvent>& events, std::vector<Uint32>& threads)
+{
+    events.clear();
+    threads.clear();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& buffer : m_buffers) {
+        Uint64 count = buffer->m_count.load(std::memory_order_acquire);
+        for (Uint64 i = 0; i < count; i++) {
+            events.push_back(buffer->at(i));
+            threads.push_back(buffer->m_thread);
+        }
+        buffer->m_exported = count;
+    }
+}
+
+size_t
+Tracer::getBufferCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_buffers.size();
+}
+
+void
+Tracer::exportChromeJson(std::ostream& out)
+{
+    std::vector<TraceEvent> events;
+    std::vector<Uint32>     threads;
+    getEvents(events, threads);
+
+    // Ticks to microseconds, measured over the life of the tracer
+    Uint64 ticks   = now() - m_startTicks;
+    double elapsed = std::chrono::duration<double, std::micro>(
+                         std::chrono::steady_clock::now() - m_startTime)
+                         .count();
+    double usPerTick =
+        ticks != 0 ? elapsed / static_cast<double>(ticks) : 1e-3;
+    Uint64 pid = processId();
+
+    // Nanosecond resolution, whatever the stream was set to
+    std::ios::fmtflags flags     = out.flags();
+    std::streamsize    precision = out.precision();
+    out.setf(std::ios::fixed, std::ios::floatfield);
+    out.precision(3);
+
+    String line;
+    out << "{\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); i++) {
+        const TraceEvent& event = events[i];
+        // Spans begun before the tracer was created start at 0
+        Uint64 begin = event.begin > m_startTicks ? event.begin - m_startTicks
+                                                  : 0;
+        Uint64 end = event.end > event.begin ? event.end - event.begin : 0;
+
+        line.clear();
+        line += i == 0 ? "\n" : ",\n";
+        line += "{\"name\":";
+        appendJsonString(line, event.name != nullptr ? event.name : "");
+        out << line << ",\"ph\":\"X\",\"ts\":"
+            << static_cast<double>(begin) * usPerTick
+            << ",\"dur\":" << static_cast<double>(end) * usPerTick
+            << ",\"pid\":" << pid << ",\"tid\":" << threads[i] << "}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    out.flags(flags);
+    out.precision(precision);
+}
+
+bool
+Tracer::writeChromeJson(const String& filename)
+{
+    std::ofstream out(filename, std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    exportChromeJson(out);
+    return static_cast<bool>(out);
+}
+
+void
+Tracer::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Buffers of exited threads are freed, the others emptied
+    auto exited = [](const std::unique_ptr<Buffer>& buffer) {
+        return buffer->m_exited;
+    };
+    m_buffers.erase(
+        std::remove_if(m_buffers.begin(), m_buffers.end(), exited),
+        m_buffers.end());
+    for (auto& buffer : m_buffers) {
+        buffer->m_count.store(0, std::memory_order_relaxed);
+        buffer->m_dropped.store(0, std::memory_order_relaxed);
+        buffer->m_exported = 0;
+    }
+}
+// Class Tracer ends
+
+} // namespace Au::Logger
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "WriterPlacement.hh"
+#include "Au/Environ.hh"
+#include "Au/ThreadPinning/ThreadPinning.hh"
+
+#include <algorithm>
+#include <charconv>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Au::Logger {
+
+namespace {
+    /**
+     * @brief Picks CPUs for the logging thread from the thread pinning
+     * topology.
+     */
+    class WriterAffinity : public AffinityVector
+    {
+      public:
+        /**
+         * @brief Highest numbered SMT sibling of the last physical core, the
+         * CPU the core pinning strategy hands out last.
+         * @return CPU number, or -1 if the topology is unknown.
+         */
+        int lastSibling()
+        {
+            if (cpuInfo.processorMap.empty()) {
+                return -1;
+            }
+            std::vector<int> cpus;
+            coreMapToCoreList(cpuInfo.processorMap.back(), cpus);
+            return cpus.empty() ? -1 : cpus.back();
+        }
+
+        /**
+         * @brief Another CPU of the NUMA node of @p cpu, so the writer reads
+         * the producer buffers from local memory. Falls back to the last
+         * level cache, then the physical core, when the node topology is
+         * unknown. The last CPU is taken, as pinning strategies fill
+         * domains from the front.
+         * @param cpu CPU of the producer.
+         * @return CPU number, @p cpu itself if it has no neighbour.
+         */
+        int near(int cpu)
+        {
+            for (const auto* domains : { &cpuInfo.nodeMap,
+                                         &cpuInfo.cacheMap,
+                                         &cpuInfo.processorMap }) {
+                for (const auto& domain : *domains) {
+                    std::vector<int> cpus;
+                    coreMapToCoreList(domain, cpus);
+                    if (cpus.size() < 2
+                        || std::find(cpus.begin(), cpus.end(), cpu)
+                               == cpus.end()) {
+                        continue;
+                    }
+                    return cpus.back() != cpu ? cpus.back()
+                                              : cpus[cpus.size() - 2];
+                }
+            }
+            return cpu;
+        }
+    };
+
+    /**
+     * @brief CPU the calling thread is running on, numbered like the
+     * topology.
+     * @return CPU number, or -1 if unknown.
+     */
+    int currentCpu()
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        PROCESSOR_NUMBER number;
+        GetCurrentProcessorNumberEx(&number);
+        const auto& groups = CpuTopology::get().groupMap;
+        int         cpu    = number.Number;
+        for (size_t group = 0; group < number.Group && group < groups.size();
+             group++) {
+            cpu += groups[group].second;
+        }
+        return cpu;
+#else
+        return sched_getcpu();
+#endif
+    }
+} // namespace
+
+int
+resolveWriterCpu(WriterPlacement placement, int cpu)
+{
+    WriterAffinity affinity;
+    switch (placement) {
+        case WriterPlacement::eCpu:
+            if (cpu >= 0 && affinity.isAllowed(cpu)) {
+                return cpu;
+            }
+            return -1;
+        case WriterPlacement::eLastSibling:
+            return affinity.lastSibling();
+        case WriterPlacement::eNearProducer: {
+            int current = currentCpu();
+            return current < 0 ? -1 : affinity.near(current);
+        }
+        default:
+            return -1;
+    }
+}
+
+int
+writerCpuFromEnv()
+{
+    StringView value = Env::get(cWriterPlacementEnv);
+    if (value == "last-sibling") {
+        return resolveWriterCpu(WriterPlacement::eLastSibling, -1);
+    }
+    if (value == "near-producer") {
+        return resolveWriterCpu(WriterPlacement::eNearProducer, -1);
+    }
+
+    int         cpu = -1;
+    const char* end = value.data() + value.size();
+    auto        res = std::from_chars(value.data(), end, cpu);
+    if (value.empty() || res.ec != std::errc{} || res.ptr != end) {
+        return -1;
+    }
+    return resolveWriterCpu(WriterPlacement::eCpu, cpu);
+}
+
+bool
+pinCurrentThread(int cpu)
+{
+    WriterAffinity affinity;
+#if defined(_WIN32) || defined(_WIN64)
+    return affinity.pinThread(GetCurrentThread(), cpu).ok();
+#else
+    return affinity.pinThread(pthread_self(), cpu).ok();
+#endif
+}
+
+} // namespace Au::Logger
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "Au/Logger/LogWriter.hh"
+
+namespace Au::Logger {
+
+/**
+ * @brief Environment variable with the initial placement of the logging
+ * thread, see LogWriter::setPlacement().
+ */
+constexpr const char* cWriterPlacementEnv = "AU_LOGGER_WRITER_CPU";
+
+/**
+ * @brief Picks the CPU for a placement of the logging thread from the
+ * topology. Must run on the thread that WriterPlacement::eNearProducer refers
+ * to.
+ * @param placement Placement strategy.
+ * @param cpu CPU for WriterPlacement::eCpu.
+ * @return CPU number, or -1 if the thread should float.
+ */
+int resolveWriterCpu(WriterPlacement placement, int cpu);
+
+/**
+ * @brief Resolves the placement named by cWriterPlacementEnv.
+ * @return CPU number, or -1 if the variable is unset or not understood.
+ */
+int writerCpuFromEnv();
+
+/**
+ * @brief Pins the calling thread to a CPU.
+ * @param cpu CPU number.
+ * @return true if the affinity was set.
+ */
+bool pinCurrentThread(int cpu);
+
+} // namespace Au::Logger
@@ -31,17 +31,39 @@ ThreadPinning::ThreadPinning()
 ThreadPinning::~ThreadPinning() {}
 
 void
+ThreadPinning::initTopology()
+{
+    CpuTopology::get();
+}
+
+Status
 ThreadPinning::pinThreads(std::vector<pthread_t> const& threadList,
                           int                           pinStrategyIndex)
 {
-    pImpl()->pinThreads(threadList, pinStrategyIndex);
+    return pImpl()->pinThreads(threadList, pinStrategyIndex);
 }
 
-void
+Status
+ThreadPinning::pinThreads(std::vector<pthread_t> const& threadList,
+                          int                           pinStrategyIndex,
+                          int                           cacheLevel)
+{
+    return pImpl()->pinThreads(threadList, pinStrategyIndex, cacheLevel);
+}
+
+Status
+ThreadPinning::pinThreads(std::vector<pthread_t> const& threadList,
+                          int                           pinStrategyIndex,
+                          std::vector<int>&             numaNodes)
+{
+    return pImpl()->pinThreads(threadList, pinStrategyIndex, numaNodes);
+}
+
+Status
 ThreadPinning::pinThreads(std::vector<pthread_t> const& threadList,
                           std::vector<int> const&       processPinGroup)
 {
-    pImpl()->pinThreads(threadList, processPinGroup);
+    return pImpl()->pinThreads(threadList, processPinGroup);
 }
 
 } // namespace Au
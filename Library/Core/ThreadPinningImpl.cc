@@ -23,31 +23,61 @@
 #include "Au/Assert.hh"
 namespace Au {
 
-void
+static bool
+isValidStrategy(int pinStrategyIndex)
+{
+    return pinStrategyIndex >= pinStrategy::SPREAD
+           && pinStrategyIndex <= pinStrategy::CACHE_COMPACT;
+}
+
+Status
 ThreadPinning::Impl::pinThreads(std::vector<pthread_t> threadList,
-                                int                    pinStrategyIndex)
+                                int                    pinStrategyIndex,
+                                int                    cacheLevel)
 {
     AUD_ASSERT(threadList.size() > 0, "Thread list is empty");
     if (threadList.size() == 0) {
-        return;
+        return StatusInvalidArgument("Thread list is empty");
     }
-    AUD_ASSERT(pinStrategyIndex >= 0 && pinStrategyIndex < 3,
-               "Invalid pin strategy index");
-    std::vector<int> processPinGroup(threadList.size());
-    if (threadList.size() == 0) {
-        return;
+    AUD_ASSERT(isValidStrategy(pinStrategyIndex), "Invalid pin strategy index");
+    if (!isValidStrategy(pinStrategyIndex)) {
+        return StatusInvalidArgument("Invalid pin strategy index");
     }
+    std::vector<int> processPinGroup(threadList.size());
     processPinGroup.reserve(threadList.size());
     // Get the processor group to pin the threads
-    getAffinityVector(processPinGroup, pinStrategyIndex);
+    getAffinityVector(processPinGroup, pinStrategyIndex, cacheLevel);
     // Pin the threads to the processor group in the processPinGroup
     if (processPinGroup.size() == 0) {
-        return;
+        return StatusNotAvailable("No processor to pin the threads to");
+    }
+    return pinThreads(threadList, processPinGroup);
+}
+
+Status
+ThreadPinning::Impl::pinThreads(std::vector<pthread_t> threadList,
+                                int                    pinStrategyIndex,
+                                std::vector<int>&      numaNodes)
+{
+    AUD_ASSERT(threadList.size() > 0, "Thread list is empty");
+    AUD_ASSERT(isValidStrategy(pinStrategyIndex), "Invalid pin strategy index");
+    numaNodes.clear();
+    if (threadList.size() == 0) {
+        return StatusInvalidArgument("Thread list is empty");
+    }
+    if (!isValidStrategy(pinStrategyIndex)) {
+        return StatusInvalidArgument("Invalid pin strategy index");
+    }
+    std::vector<int> processPinGroup(threadList.size());
+    getAffinityVector(processPinGroup, pinStrategyIndex);
+    if (processPinGroup.size() == 0) {
+        return StatusNotAvailable("No processor to pin the threads to");
     }
-    pinThreads(threadList, processPinGroup);
+    getNumaNodes(processPinGroup, numaNodes);
+    return pinThreads(threadList, processPinGroup);
 }
 
-void
+Status
 ThreadPinning::Impl::pinThreads(std::vector<pthread_t>  threadList,
                                 std::vector<int> const& processPinGroup)
 {
@@ -56,10 +86,11 @@ ThreadPinning::Impl::pinThreads(std::vector<pthread_t>  threadList,
     AUD_ASSERT(threadList.size() == processPinGroup.size(),
                "Thread list and processor group size mismatch");
     if (threadList.size() == 0 || threadList.size() != processPinGroup.size()) {
-        return;
+        return StatusInvalidArgument(
+            "Thread list and processor group size mismatch");
     }
     // Pin the threads to the processor group in the processPinGroup
-    setAffinity(threadList, processPinGroup);
+    return setAffinity(threadList, processPinGroup);
 }
 
 } // namespace Au
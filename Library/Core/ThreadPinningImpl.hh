@@ -37,11 +37,33 @@ class ThreadPinning::Impl : public AffinityVector
      * @param[in]      threadList        ThreadIds to pin
      *
      * @param[in]      pinStrategyIndex  0 - spread , 1 - Core, 2 - Logical
-     * Processor
+     * Processor, 3 - NUMA compact, 4 - NUMA spread, 5 - Cache compact
      *
-     * @return         None
+     * @param[in]      cacheLevel        Cache level of spread and cache
+     * compact
+     *
+     * @return         StatusOk() if every thread was pinned
+     */
+    Status pinThreads(std::vector<pthread_t> threadList,
+                      int                    pinStrategyIndex,
+                      int                    cacheLevel = 3);
+    /**
+     * @brief          PinThreads
+     *
+     * @details        Pin Threads and report the NUMA node of each.
+     *
+     * @param[in]      threadList        ThreadIds to pin
+     *
+     * @param[in]      pinStrategyIndex  0 - spread , 1 - Core, 2 - Logical
+     * Processor, 3 - NUMA compact, 4 - NUMA spread, 5 - Cache compact
+     *
+     * @param[out]     numaNodes         NUMA node per thread
+     *
+     * @return         StatusOk() if every thread was pinned
      */
-    void pinThreads(std::vector<pthread_t> threadList, int pinStrategyIndex);
+    Status pinThreads(std::vector<pthread_t> threadList,
+                      int                    pinStrategyIndex,
+                      std::vector<int>&      numaNodes);
     /**
      * @brief          pinThreads
      *
@@ -51,8 +73,9 @@ class ThreadPinning::Impl : public AffinityVector
      *
      * @param[in]      processPinGroup   Processor Group to pin the threads
      *
+     * @return         StatusOk() if every thread was pinned
      */
-    void pinThreads(std::vector<pthread_t>  threadList,
-                    std::vector<int> const& processPinGroup);
+    Status pinThreads(std::vector<pthread_t>  threadList,
+                      std::vector<int> const& processPinGroup);
 };
 } // namespace Au
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -28,15 +28,15 @@
 
 #pragma once
 
-#include "Au/Logger/Logger.hh"
+#include "Au/Logger/LogWriter.hh"
 
+/**
+ * @brief What a logger_ctx_t points to. A context does not hold on to a
+ * LogWriter: every call resolves the running one through
+ * LogWriter::current(), so a context stays usable after
+ * LogWriter::shutdown(), which starts a new writer on its next call.
+ */
 struct LoggerCtx
 {
-    std::unique_ptr<Au::Logger::LogWriter>  logWriter;
-    std::unique_ptr<Au::Logger::LogManager> logger;
-    LoggerCtx()
-        : logWriter(nullptr)
-        , logger(nullptr)
-    {
-    }
+    LoggerCtx() = default;
 };
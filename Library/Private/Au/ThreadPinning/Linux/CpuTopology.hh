@@ -21,16 +21,18 @@
  */
 #pragma once
 #include <algorithm>
-#include <bitset>
-#include <cmath>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <dirent.h>
-#include <fstream>
+#include <fcntl.h>
 #include <iostream>
-#include <sstream>
 #include <stdint.h>
 #include <string>
+#include <sched.h>
 #include <sys/sysinfo.h>
 #include <tuple>
+#include <unistd.h>
 #include <vector>
 
 namespace Au {
@@ -38,197 +40,617 @@ typedef unsigned long             DWORD;
 typedef unsigned long             KAFFINITY;
 typedef std::pair<KAFFINITY, int> CoreMask;
 
-class LogicalProcessorInformation
+/* Kind of a cache, numbered like PROCESSOR_CACHE_TYPE on Windows */
+enum class CacheType
 {
+    eUnified     = 0,
+    eInstruction = 1,
+    eData        = 2
+};
+
+/* The caches of one level and type and the processors sharing each */
+struct CacheLevel
+{
+    int                                level;
+    CacheType                          type;
+    std::vector<std::vector<CoreMask>> map;
+};
+
+/* Root of the sysfs processor and NUMA node information */
+static constexpr const char* cSysfsRoot = "/sys/devices/system";
+/* Root of the cgroup v2 hierarchy */
+static constexpr const char* cCgroupRoot = "/sys/fs/cgroup";
 
+/**
+ * @brief       Reads sysfs files into a reusable buffer.
+ *
+ * @details     Every file is read with open()/read(), without streams, into
+ * one buffer that only grows when a file does not fit (long cpumaps of very
+ * large machines).
+ */
+class SysfsReader
+{
   public:
-    std::string    filename;
-    int            cpuId;
-    DIR*           dirp;
-    struct dirent* dp; // Pointer to the directory entry
-
-    explicit LogicalProcessorInformation(const std::string& filename)
-        : filename(filename)
-        , cpuId(0)
-        , dirp(opendir("/sys/devices/system/cpu/"))
-        , dp(NULL)
+    explicit SysfsReader(const std::string& root)
+        : m_path(root)
+        , m_rootLength(root.size())
+        , m_buffer(cBufferSize)
+        , m_length(0)
     {
     }
-    // Copy constructor
-    LogicalProcessorInformation(LogicalProcessorInformation& other)
-        : filename(other.filename)
-        , cpuId(other.cpuId)
-        , dirp(other.dirp)
-        , dp(other.dp)
+
+    /**
+     * @brief       Read a file below the root.
+     *
+     * @param[in]   path  Path relative to the root, starting with '/'
+     *
+     * @return      false if the file can not be opened, e.g. the topology of
+     * an offline processor
+     */
+    bool read(const std::string& path)
     {
-        other.dp   = NULL;
-        other.dirp = NULL;
+        m_path.resize(m_rootLength);
+        m_path += path;
+        m_length = 0;
+
+        int fd = open(m_path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+        for (;;) {
+            // Keep room for the terminating NUL
+            if (m_length + 1 == m_buffer.size())
+                m_buffer.resize(m_buffer.size() * 2);
+            ssize_t n = ::read(fd,
+                               m_buffer.data() + m_length,
+                               m_buffer.size() - m_length - 1);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                break;
+            m_length += n;
+        }
+        close(fd);
+        m_buffer[m_length] = '\0';
+        return true;
     }
-    // = operator
-    LogicalProcessorInformation& operator=(LogicalProcessorInformation& other)
+
+    /* Contents of the last file read, NUL terminated */
+    const char* data() const { return m_buffer.data(); }
+    size_t      size() const { return m_length; }
+
+  private:
+    static constexpr size_t cBufferSize = 4096;
+
+    std::string       m_path;
+    size_t            m_rootLength;
+    std::vector<char> m_buffer;
+    size_t            m_length;
+};
+
+class CpuTopology
+{
+  private:
+    static constexpr int cWordBits = 32;
+
+    /**
+     * @brief            Eliminate duplicates from the Map.
+     *
+     * @details          This function eliminates duplicates from the Map.
+     *
+     * @param[in/out]    std::vector<std::vector<CoreMask>>&
+     * Map A vector of unique pairs from the Map.
+     * @return      void
+     */
+    void eliminateDuplicates(std::vector<std::vector<CoreMask>>& Map)
     {
-        if (this != &other) {
-            filename   = other.filename;
-            cpuId      = other.cpuId;
-            dirp       = other.dirp;
-            dp         = other.dp;
-            other.dp   = NULL;
-            other.dirp = NULL;
-        }
-        return *this;
+        std::sort(Map.begin(), Map.end());
+        auto newMap = std::unique(Map.begin(), Map.end());
+        Map.erase(newMap, Map.end());
+        // Offline processors leave an empty entry behind
+        if (Map.size() != 0 && Map.front().empty())
+            Map.erase(Map.begin());
     }
-    ~LogicalProcessorInformation() { closedir(dirp); }
+
     /**
-     * @brief       Move to the next directory entry.
+     * @brief            Compare two vectors.
+     *
+     * @details          Used to reorder the vector after eliminating
+     * duplicates.
+     *
+     * @param[in]        const std::vector<CoreMask>& a
+     *                   A vector of pairs.
+     * @param[in]        const std::vector<CoreMask>& b
+     *                   A vector of pairs.
      *
-     * @details     This function moves to the next directory
-     *              corresponding to cpu<id>, updates cpuid memeber variable
+     * @return           bool
+     */
+    static bool compareVectors(const std::vector<CoreMask>& a,
+                               const std::vector<CoreMask>& b)
+    {
+        if (a[0].second == b[0].second)
+            return a[0].first < b[0].first;
+        else
+            return a[0].second < b[0].second;
+    }
+
+    /**
+     * @brief            List the processor ids of masks.
      *
-     * @param[in]   void
+     * @param[in]        const std::vector<CoreMask>& Map
+     * @param[out]       std::vector<int>& cpus   ids, appended in order
      *
-     * @return      void
+     * @return           void
      */
-    void MoveNext()
+    static void maskToCpus(const std::vector<CoreMask>& Map,
+                           std::vector<int>&            cpus)
     {
-        // Move to the next directory entry
-        while ((dp = readdir(dirp)) != NULL) {
-            std::string dirName(dp->d_name);
-            if (dirName.find("cpu") == 0 && isdigit(dirName[3])) {
-                cpuId = std::stoi(dirName.substr(3));
-                break;
+        for (auto mask : Map) {
+            while (mask.first) {
+                int bit = __builtin_ctzl(mask.first);
+                cpus.push_back(mask.second * cWordBits + bit);
+                mask.first &= mask.first - 1;
             }
         }
     }
 
     /**
-     * @brief       Parse the line and store the information.
-     *
-     * @details     This function parses the line and stores the information in
-     * the Map. The line is a comma separated string of hexadecimal values.
+     * @brief            List the processors to read the topology of.
      *
-     * @param[out]   std::vector<CoreMask>& Map
-     *               A vector of pairs that stores the mask and the position of
-     * the mask. obtained from parsing the line.
+     * @details          Uses cpu/online, or the cpu<id> directories if the
+     * file is not there.
      *
-     * @param[in]   std::string line
+     * @param[in]        SysfsReader& reader
+     * @param[in]        const std::string& root
+     * @param[out]       std::vector<int>& cpus
      *
-     * @return      void
+     * @return           true if cpu/online was found
      */
-    void parseLine(std::vector<CoreMask>& Map, std::string line)
+    static bool listCpus(SysfsReader&       reader,
+                         const std::string& root,
+                         std::vector<int>&  cpus)
     {
-        std::reverse(line.begin(), line.end());
-        std::stringstream ss(line);
-        int               position = 0;
-        std::string       chunk;
-        int               nonZeroMask = 0;
+        if (reader.read("/cpu/online")) {
+            std::vector<CoreMask> online;
+            parseCpuList(online, reader.data(), reader.size());
+            maskToCpus(online, cpus);
+            return true;
+        }
 
-        while (std::getline(ss, chunk, ',')) {
-            if (std::stoull(chunk, nullptr, 16)) {
-                std::reverse(chunk.begin(), chunk.end());
+        DIR* dirp = opendir((root + "/cpu/").c_str());
+        if (dirp) {
+            struct dirent* dp;
+            while ((dp = readdir(dirp)) != NULL) {
+                if (strncmp(dp->d_name, "cpu", 3) == 0
+                    && isdigit(dp->d_name[3]))
+                    cpus.push_back(atoi(dp->d_name + 3));
+            }
+            closedir(dirp);
+        }
+        std::sort(cpus.begin(), cpus.end());
+        return false;
+    }
 
-                Map.resize(nonZeroMask + 1);
-                Map[nonZeroMask].first  = std::stoull(chunk, nullptr, 16);
-                Map[nonZeroMask].second = position;
+    /**
+     * @brief            Read the masks of all processors for one file.
+     *
+     * @details          Sibling processors report the same mask, so a file is
+     * only read for processors not seen in a mask read before, e.g. once per
+     * L3 cache instead of once per processor.
+     *
+     * @param[out]       std::vector<std::vector<CoreMask>>& Map
+     * @param[in]        SysfsReader& reader
+     * @param[in]        const std::vector<int>& cpus   processors to read
+     * @param[in]        const char* filename           file below cpu<id>
+     *
+     * @return           void
+     */
+    void readCpuMap(std::vector<std::vector<CoreMask>>& Map,
+                    SysfsReader&                        reader,
+                    const std::vector<int>&             cpus,
+                    const char*                         filename)
+    {
+        std::vector<bool> seen;
+        std::vector<int>  siblings;
+        std::string       path;
+        for (int cpu : cpus) {
+            if (size_t(cpu) < seen.size() && seen[cpu])
+                continue;
+            path = "/cpu/cpu";
+            path += std::to_string(cpu);
+            path += filename;
+            // For offline processors the file is not present
+            if (!reader.read(path))
+                continue;
 
-                nonZeroMask++;
+            std::vector<CoreMask> masks;
+            parseCpuMap(masks, reader.data(), reader.size());
+            siblings.clear();
+            maskToCpus(masks, siblings);
+            siblings.push_back(cpu);
+            for (int sibling : siblings) {
+                if (seen.size() <= size_t(sibling))
+                    seen.resize(sibling + 1, false);
+                seen[sibling] = true;
             }
-            position++;
+            if (masks.size() != 0)
+                Map.push_back(std::move(masks));
         }
+        eliminateDuplicates(Map);
+        std::sort(Map.begin(), Map.end(), compareVectors);
     }
 
     /**
-     * @brief       Process the file and store the information.
+     * @brief            Collect the cache --> Logical core mappings.
+     *
+     * @details          Lists cache/index<n> of the first processor and reads
+     * level, type and shared_cpu_map of every index, assuming all processors
+     * have the same cache levels. cacheMap is the level 3 map.
      *
-     * @details     This function processes the file and stores the information
-     * in the Map. The file is a comma separated string of hexadecimal values.
+     * @param[in]        SysfsReader& reader
+     * @param[in]        const std::string& root
+     * @param[in]        const std::vector<int>& cpus   processors to read
      *
-     * @param[out]   std::vector<CoreMask>& Map
-     *               A vector of pairs that stores the mask and the position of
-     * the mask. obtained from parsing the line.
+     * @return           void
+     */
+    void readCaches(SysfsReader&            reader,
+                    const std::string&      root,
+                    const std::vector<int>& cpus)
+    {
+        if (cpus.empty())
+            return;
+
+        std::string      cpuDir = "/cpu/cpu" + std::to_string(cpus[0]);
+        std::vector<int> indices;
+        DIR*             dirp = opendir((root + cpuDir + "/cache/").c_str());
+        if (dirp) {
+            struct dirent* dp;
+            while ((dp = readdir(dirp)) != NULL) {
+                if (strncmp(dp->d_name, "index", 5) == 0
+                    && isdigit(dp->d_name[5]))
+                    indices.push_back(atoi(dp->d_name + 5));
+            }
+            closedir(dirp);
+        }
+        std::sort(indices.begin(), indices.end());
+
+        for (int index : indices) {
+            std::string indexDir = "/cache/index" + std::to_string(index);
+            CacheLevel  cache{ 0, CacheType::eUnified, {} };
+            if (!reader.read(cpuDir + indexDir + "/level"))
+                continue;
+            cache.level = atoi(reader.data());
+            if (reader.read(cpuDir + indexDir + "/type")) {
+                if (strncmp(reader.data(), "Data", 4) == 0)
+                    cache.type = CacheType::eData;
+                else if (strncmp(reader.data(), "Instruction", 11) == 0)
+                    cache.type = CacheType::eInstruction;
+            }
+            indexDir += "/shared_cpu_map";
+            readCpuMap(cache.map, reader, cpus, indexDir.c_str());
+            if (cache.level == 3 && cache.type != CacheType::eInstruction
+                && cacheMap.empty())
+                cacheMap = cache.map;
+            caches.push_back(std::move(cache));
+        }
+    }
+
+    /**
+     * @brief            Collect the NUMA node --> Logical core mapping.
      *
-     * @param[in]   std::ifstream& file
+     * @details          Reads /sys/devices/system/node/node<id>/cpulist, the
+     * map is indexed by node id and nodes without processors are left empty.
+     * Without NUMA information all processors form node 0.
      *
-     * @return      void
+     * @return           void
      */
-    void processFile(std::vector<CoreMask>& Map, std::ifstream& file)
+    void readNodeMap(SysfsReader& reader, const std::string& root)
     {
-        std::string line;
-        if (getline(file, line))
-            parseLine(Map, line);
+        DIR* dirp = opendir((root + "/node/").c_str());
+        if (dirp) {
+            struct dirent* dp;
+            while ((dp = readdir(dirp)) != NULL) {
+                if (strncmp(dp->d_name, "node", 4) != 0
+                    || !isdigit(dp->d_name[4]))
+                    continue;
+                size_t node = strtoul(dp->d_name + 4, NULL, 10);
+                if (nodeMap.size() <= node)
+                    nodeMap.resize(node + 1);
+                std::string path = "/node/";
+                path += dp->d_name;
+                path += "/cpulist";
+                if (reader.read(path))
+                    parseCpuList(nodeMap[node], reader.data(), reader.size());
+            }
+            closedir(dirp);
+        }
+        if (nodeMap.empty()) {
+            nodeMap.resize(1);
+            for (const auto& core : processorMap) {
+                for (const auto& mask : core) {
+                    auto word = std::find_if(nodeMap[0].begin(),
+                                             nodeMap[0].end(),
+                                             [&](const CoreMask& m) {
+                                                 return m.second
+                                                        == mask.second;
+                                             });
+                    if (word == nodeMap[0].end())
+                        nodeMap[0].push_back(mask);
+                    else
+                        word->first |= mask.first;
+                }
+            }
+            std::sort(nodeMap[0].begin(),
+                      nodeMap[0].end(),
+                      [](const CoreMask& a, const CoreMask& b) {
+                          return a.second < b.second;
+                      });
+        }
     }
 
     /**
-     * @brief       Get the current directory entry.
+     * @brief            AND the masks of a Map with a dense word mask.
      *
-     * @details     This function gets the current directory entry.
+     * @details          Masks that become 0 are dropped.
      *
-     * @param[out]   std::vector<CoreMask>& Map
-     *               A vector of pairs that stores the mask and the position of
-     * the mask. obtained from parsing the line.
+     * @param[in/out]    std::vector<CoreMask>& Map
+     * @param[in]        const std::vector<KAFFINITY>& words  indexed by word
      *
-     * @return      void
+     * @return           void
      */
-    void Current(std::vector<CoreMask>& Map)
+    static void andMask(std::vector<CoreMask>&        Map,
+                        const std::vector<KAFFINITY>& words)
     {
-        if (dp) {
-            std::string   dirName(dp->d_name);
-            std::ifstream file("/sys/devices/system/cpu/" + dirName + filename);
-            // check if file is open, for offline cpus the file will not be
-            // present.
-            //  Hence will fail to open.
-            if (file.is_open()) {
-                processFile(Map, file);
-            }
+        for (auto& mask : Map) {
+            size_t word = mask.second;
+            mask.first &= word < words.size() ? words[word] : 0;
         }
+        auto empty = [](const CoreMask& m) { return m.first == 0; };
+        Map.erase(std::remove_if(Map.begin(), Map.end(), empty), Map.end());
     }
-};
 
-class CpuTopology
-{
-  private:
     /**
-     * @brief            Eliminate duplicates from the Map.
+     * @brief            AND every entry of a map, dropping empty entries.
      *
-     * @details          This function eliminates duplicates from the Map.
+     * @param[in/out]    std::vector<std::vector<CoreMask>>& Map
+     * @param[in]        const std::vector<KAFFINITY>& words  indexed by word
      *
-     * @param[in/out]    std::vector<std::vector<CoreMask>>&
-     * Map A vector of unique pairs from the Map.
-     * @return      void
+     * @return           void
      */
-    void eliminateDuplicates(std::vector<std::vector<CoreMask>>& Map)
+    static void andMap(std::vector<std::vector<CoreMask>>& Map,
+                       const std::vector<KAFFINITY>&       words)
     {
-        std::sort(Map.begin(), Map.end());
-        auto newMap = std::unique(Map.begin(), Map.end());
-        Map.erase(newMap, Map.end());
+        for (auto& entry : Map) {
+            andMask(entry, words);
+        }
+        Map.erase(std::remove_if(Map.begin(),
+                                 Map.end(),
+                                 [](const std::vector<CoreMask>& entry) {
+                                     return entry.empty();
+                                 }),
+                  Map.end());
     }
 
     /**
-     * @brief            Compare two vectors.
+     * @brief            Read the processors the process may run on.
      *
-     * @details          Used to reorder the vector after eliminating
-     * duplicates.
+     * @details          The affinity of the process (of its main thread, the
+     * calling thread may be pinned already), restricted further by the cgroup
+     * v2 cpuset.cpus.effective of the process if there is one.
      *
-     * @param[in]        const std::vector<CoreMask>& a
-     *                   A vector of pairs.
-     * @param[in]        const std::vector<CoreMask>& b
-     *                   A vector of pairs.
+     * @param[out]       std::vector<CoreMask>& allowed
      *
-     * @return           bool
+     * @return           false if the affinity can not be read
      */
-    static bool compareVectors(const std::vector<CoreMask>& a,
-                               const std::vector<CoreMask>& b)
+    bool readAllowedMap(std::vector<CoreMask>& allowed)
     {
-        if (a[0].second == b[0].second)
-            return a[0].first < b[0].first;
-        else
-            return a[0].second < b[0].second;
+        int        nrCpus = std::max<int>(groupMap.size() * cWordBits, 1024);
+        cpu_set_t* set    = NULL;
+        size_t     size   = 0;
+        for (;;) {
+            set  = CPU_ALLOC(nrCpus);
+            size = CPU_ALLOC_SIZE(nrCpus);
+            if (set == NULL)
+                return false;
+            CPU_ZERO_S(size, set);
+            if (sched_getaffinity(getpid(), size, set) == 0)
+                break;
+            CPU_FREE(set);
+            // The kernel supports more processors than the set holds
+            if (errno != EINVAL || nrCpus >= (1 << 20))
+                return false;
+            nrCpus *= 2;
+        }
+
+        std::vector<KAFFINITY> words((nrCpus + cWordBits - 1) / cWordBits, 0);
+        for (int cpu = 0; cpu < nrCpus; cpu++) {
+            if (CPU_ISSET_S(cpu, size, set))
+                words[cpu / cWordBits] |= KAFFINITY(1) << (cpu % cWordBits);
+        }
+        CPU_FREE(set);
+
+        // cgroup v2 only, the line of the unified hierarchy is "0::<path>"
+        SysfsReader reader("");
+        std::string path;
+        if (reader.read("/proc/self/cgroup")) {
+            for (const char* line = reader.data(); *line != '\0';) {
+                size_t length = strcspn(line, "\n");
+                if (strncmp(line, "0::/", 4) == 0)
+                    path.assign(line + 3, length - 3);
+                line += length + (line[length] == '\n');
+            }
+        }
+        std::vector<CoreMask> effective;
+        if (!path.empty()
+            && reader.read(cCgroupRoot + path + "/cpuset.cpus.effective"))
+            parseCpuList(effective, reader.data(), reader.size());
+        if (effective.size() != 0) {
+            std::vector<KAFFINITY> cgroup(words.size(), 0);
+            for (const auto& mask : effective) {
+                if (size_t(mask.second) < cgroup.size())
+                    cgroup[mask.second] = mask.first;
+            }
+            for (size_t word = 0; word < words.size(); word++) {
+                words[word] &= cgroup[word];
+            }
+        }
+
+        for (size_t word = 0; word < words.size(); word++) {
+            if (words[word])
+                allowed.push_back(std::make_pair(words[word], int(word)));
+        }
+        return true;
     }
 
   public:
     uint32_t                           active_processors;
     std::vector<std::vector<CoreMask>> processorMap;
     std::vector<std::vector<CoreMask>> cacheMap;
+    /* One entry per 32 bit sysfs word, second is the number of processor
+     * ids the word covers, used to number the processors */
     std::vector<CoreMask>              groupMap;
+    std::vector<std::vector<CoreMask>> nodeMap;
+    /* Every cache level and type, in sysfs index order */
+    std::vector<CacheLevel> caches;
+
+    /**
+     * @brief       Parse a cpumap and store the information.
+     *
+     * @details     A cpumap is a comma separated list of 32 bit hexadecimal
+     * words, the most significant first, e.g. "00000000,000000ff".
+     *
+     * @param[out]  std::vector<CoreMask>& Map
+     *              Non zero masks with their word position, lowest first.
+     *
+     * @param[in]   const char* text, size_t length
+     *
+     * @return      void
+     */
+    static void parseCpuMap(std::vector<CoreMask>& Map,
+                            const char*            text,
+                            size_t                 length)
+    {
+        int words = 1;
+        for (size_t i = 0; i < length; i++) {
+            words += text[i] == ',';
+        }
+
+        size_t    first    = Map.size();
+        int       position = words - 1;
+        KAFFINITY mask     = 0;
+        for (size_t i = 0; i <= length; i++) {
+            char c = i < length ? text[i] : ',';
+            if (c == ',') {
+                if (mask)
+                    Map.push_back(std::make_pair(mask, position));
+                mask = 0;
+                position--;
+            } else if (isxdigit(c)) {
+                int digit = isdigit(c) ? c - '0' : (c | 0x20) - 'a' + 10;
+                mask      = mask << 4 | KAFFINITY(digit);
+            }
+        }
+        std::reverse(Map.begin() + first, Map.end());
+    }
+
+    /**
+     * @brief       Parse a cpulist and store the information.
+     *
+     * @details     A cpulist is a comma separated list of processor numbers
+     * and ranges, e.g. "0-7,16-23". The processors are stored as 32 bit masks
+     * like the words of a sysfs cpumap, see parseCpuMap().
+     *
+     * @param[out]  std::vector<CoreMask>& Map
+     *              Non zero masks with their word position, in order.
+     *
+     * @param[in]   const char* text, size_t length
+     *
+     * @return      void
+     */
+    static void parseCpuList(std::vector<CoreMask>& Map,
+                             const char*            text,
+                             size_t                 length)
+    {
+        size_t first   = Map.size();
+        auto   setBits = [&](int word, KAFFINITY bits) {
+            // Lists are normally sorted, the ranges only grow the back
+            if (Map.size() == first || Map.back().second < word) {
+                Map.push_back(std::make_pair(bits, word));
+                return;
+            }
+            auto mask = std::find_if(
+                Map.begin() + first, Map.end(), [&](const CoreMask& m) {
+                    return m.second >= word;
+                });
+            if (mask != Map.end() && mask->second == word)
+                mask->first |= bits;
+            else
+                Map.insert(mask, std::make_pair(bits, word));
+        };
+
+        const char* end = text + length;
+        while (text < end) {
+            if (!isdigit(*text)) {
+                text++;
+                continue;
+            }
+            char* next;
+            int   low  = strtol(text, &next, 10);
+            int   high = low;
+            if (next < end && *next == '-' && next + 1 < end
+                && isdigit(next[1]))
+                high = strtol(next + 1, &next, 10);
+            text = next;
+
+            for (int word = low / cWordBits; word <= high / cWordBits; word++) {
+                int       from = std::max(low - word * cWordBits, 0);
+                int       to   = std::min(high - word * cWordBits, 31);
+                KAFFINITY bits = ((KAFFINITY(2) << to) - 1)
+                                 & ~((KAFFINITY(1) << from) - 1);
+                setBits(word, bits);
+            }
+        }
+    }
+
+    static void parseCpuList(std::vector<CoreMask>& Map,
+                             const std::string&     line)
+    {
+        parseCpuList(Map, line.data(), line.size());
+    }
+
+    /**
+     * @brief       Restrict the topology to a set of processors.
+     *
+     * @details     Removes the processors outside allowed from the core,
+     * cache and NUMA node maps, so that every strategy only picks allowed
+     * processors. Processors keep their numbers, NUMA nodes their index.
+     *
+     * @param[in]   const std::vector<CoreMask>& allowed
+     *
+     * @return      void
+     */
+    void restrict(const std::vector<CoreMask>& allowed)
+    {
+        std::vector<KAFFINITY> words;
+        for (const auto& mask : allowed) {
+            if (words.size() <= size_t(mask.second))
+                words.resize(mask.second + 1, 0);
+            words[mask.second] |= mask.first;
+        }
+
+        andMap(processorMap, words);
+        andMap(cacheMap, words);
+        for (auto& cache : caches) {
+            andMap(cache.map, words);
+        }
+        for (auto& node : nodeMap) {
+            andMask(node, words);
+        }
+        active_processors = 0;
+        for (size_t word = 0; word < groupMap.size(); word++) {
+            groupMap[word].first &= word < words.size() ? words[word] : 0;
+            active_processors += __builtin_popcountl(groupMap[word].first);
+        }
+    }
 
     static const CpuTopology& get()
     {
@@ -236,50 +658,56 @@ class CpuTopology
         return info;
     }
 
-    CpuTopology()
+    /**
+     * @brief       Read the topology.
+     *
+     * @details     Reads every needed sysfs file once, in one pass over the
+     * online processors. get() builds the topology on first use, call
+     * ThreadPinning::initTopology() or au_topology_init() early to keep it
+     * out of timed regions.
+     *
+     * @param[in]   root  sysfs root, tests can point it to a synthetic tree
+     */
+    explicit CpuTopology(const std::string& root = cSysfsRoot)
         : active_processors(0)
         , processorMap{}
         , cacheMap{}
         , groupMap{}
+        , nodeMap{}
+        , caches{}
     {
-        active_processors = get_nprocs();
-        LogicalProcessorInformation processorInfo("/topology/thread_siblings");
-        LogicalProcessorInformation cacheInfo("/cache/index3/shared_cpu_map");
+        SysfsReader      reader(root);
+        std::vector<int> cpus;
+        if (listCpus(reader, root, cpus))
+            active_processors = cpus.size();
+        else
+            active_processors = get_nprocs();
 
         // Collect the physical core -> logical core mapping
-        processorMap.resize(active_processors);
-        processorInfo.MoveNext();
-        while (processorInfo.dp) {
-            processorInfo.Current(processorMap[processorInfo.cpuId]);
-            processorInfo.MoveNext();
-        }
-        eliminateDuplicates(processorMap);
-        std::sort(processorMap.begin(), processorMap.end(), compareVectors);
-
-        // Collect the L3 Cache --> Logical core mapping
-        cacheMap.resize(active_processors);
-        cacheInfo.MoveNext();
-        while (cacheInfo.dp) {
-            cacheInfo.Current(cacheMap[cacheInfo.cpuId]);
-            cacheInfo.MoveNext();
-        }
+        readCpuMap(processorMap, reader, cpus, "/topology/thread_siblings");
 
-        eliminateDuplicates(cacheMap);
-        std::sort(cacheMap.begin(), cacheMap.end(), compareVectors);
+        // Collect the Cache --> Logical core mappings of every level
+        readCaches(reader, root, cpus);
 
-        // Collect the Group --> Logical core mapping
-        groupMap.resize(active_processors);
-        for (size_t cpuId = 0; cpuId < processorMap.size(); cpuId++) {
-            for (auto processorMask : processorMap[cpuId]) {
-                int groupIndex = processorMask.second;
+        // Collect the Group --> Logical core mapping, processors are numbered
+        // by their position, so every word covers cWordBits ids even if some
+        // of them are offline
+        for (const auto& core : processorMap) {
+            for (auto processorMask : core) {
+                size_t groupIndex = processorMask.second;
+                if (groupMap.size() <= groupIndex)
+                    groupMap.resize(groupIndex + 1,
+                                    std::make_pair(KAFFINITY(0), cWordBits));
                 groupMap[groupIndex].first |= processorMask.first;
-                std::bitset<32> bits(processorMask.first);
-                groupMap[groupIndex].second += bits.count();
             }
         }
-        while (!groupMap.back().first) {
-            groupMap.pop_back();
-        }
+
+        readNodeMap(reader, root);
+
+        // Only the processors of the process cpuset and cgroup can be used
+        std::vector<CoreMask> allowed;
+        if (root == cSysfsRoot && readAllowedMap(allowed) && !allowed.empty())
+            restrict(allowed);
     }
 };
 } // namespace Au
@@ -34,51 +34,80 @@
 #endif
 
 #include "Au/Assert.hh"
+#include "Au/Status.hh"
 #include <Au/ThreadPinning.hh>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace Au {
 
 class AffinityVector
 {
   protected:
     const CpuTopology& cpuInfo;
+    std::vector<int>   groupOffsets;
+
+    /**
+     * @brief           Calculate the group offsets
+     *
+     * @details         This function sums up the processors of the groups
+     *                  preceding each group of the groupMap once, so that
+     *                  calculateOffset() does not walk the groupMap for every
+     *                  processor.
+     *
+     * @param[in]       groupMap    Map of groups
+     *
+     * @return          Offset of each group
+     */
+    static std::vector<int> calculateOffsets(
+        const std::vector<CoreMask>& groupMap)
+    {
+        std::vector<int> offsets(groupMap.size(), 0);
+        for (size_t i = 1; i < groupMap.size(); i++) {
+            offsets[i] = offsets[i - 1] + groupMap[i - 1].second;
+        }
+        return offsets;
+    }
 
-  private:
     /**
      * @brief           Calculate the offset
      *
-     * @details         This function calculates the offset based on the group
-     *                  and groupMap
+     * @details         This function returns the number of the first processor
+     *                  of a group of the groupMap
      *
      * @param[in]       group       Group number
      *
-     * @param[in]       groupMap    Map of groups
-     *
      * @return          int
      */
-    int calculateOffset(int group, const std::vector<CoreMask>& groupMap)
+    int calculateOffset(int group)
     {
-        int offset = 0;
-        if (group > 0) {
-            for (int i = 0; i < group; i++) {
-                offset += groupMap[i].second;
-            }
-        }
-        return offset;
+        AUD_ASSERT(size_t(group) < groupOffsets.size(), "Invalid group");
+        return size_t(group) < groupOffsets.size() ? groupOffsets[group] : 0;
     }
 
     /**
      * @brief           Calculate the core number
      *
      * @details         This function calculates the core number based on the
-     *                  bitMap
+     *                  bitMap, i.e. the position of the lowest set bit. The
+     *                  mask must not be 0.
      *
      * @param[in]       pMap    ProcessorMap
      *
      * @return          int
      */
-    int calculateCoreNum(CoreMask& pMap)
+    int calculateCoreNum(const CoreMask& pMap)
     {
-        return log2(pMap.first & -1 * pMap.first);
+        AUD_ASSERT(pMap.first != 0, "Empty core mask");
+#if defined(_MSC_VER)
+        unsigned long index = 0;
+        _BitScanForward64(&index, pMap.first);
+        return int(index);
+#else
+        return __builtin_ctzll(pMap.first);
+#endif
     }
 
     /**
@@ -98,13 +127,38 @@ class AffinityVector
         pMap.first &= ~(1ULL << coreId);
     }
 
+    /**
+     * @brief           Get the caches of a level
+     *
+     * @details         This function returns the processor map of the data
+     *                  or unified caches of a level, cacheMap for level 3 or
+     *                  if the level is not known.
+     *
+     * @param[in]       cacheLevel  Cache level, 1 to 3
+     *
+     * @return          Processor map, one entry per cache
+     */
+    const std::vector<std::vector<CoreMask>>& getCacheLevelMap(int cacheLevel)
+    {
+        if (cacheLevel == 3)
+            return cpuInfo.cacheMap;
+        for (const auto& cache : cpuInfo.caches) {
+            if (cache.level == cacheLevel
+                && cache.type != CacheType::eInstruction)
+                return cache.map;
+        }
+        return cpuInfo.cacheMap;
+    }
+
     /**
      * @brief           Get the cache affinity map
      *
      * @details         This function creates a map that maps the given threads
      * to cache groups.
      *
-     * @param[in]       procVect    Vector to store the spread affinity
+     * @param[in]       threadCount Number of threads
+     *
+     * @param[in]       caches      Processor map of the caches
      *
      * @param[out]      cacheMap    Map to store the cache affinity
      * It is a map of cache number to a vector of thread indexes
@@ -116,13 +170,14 @@ class AffinityVector
      *
      * @return          void
      */
-    void getCacheAffinityMap(int                              threadCount,
-                             std::map<int, std::vector<int>>& cacheMap)
+    void getCacheAffinityMap(
+        int                                       threadCount,
+        const std::vector<std::vector<CoreMask>>& caches,
+        std::map<int, std::vector<int>>&          cacheMap)
     {
 
         std::vector<int> procVect(threadCount);
-        createVector(
-            procVect, 0, threadCount - 1, 0, cpuInfo.cacheMap.size() - 1);
+        createVector(procVect, 0, threadCount - 1, 0, caches.size() - 1);
         for (size_t thread = 0; thread < procVect.size(); thread++) {
             int coreNum = procVect[thread];
             cacheMap[coreNum].push_back(thread);
@@ -144,11 +199,11 @@ class AffinityVector
                            std::vector<int>&            coreList)
     {
         for (auto pMap : processorMap) {
+            int offset = calculateOffset(pMap.second);
             while (pMap.first > 0) {
-                coreList.push_back(
-                    calculateCoreNum(pMap)
-                    + calculateOffset(pMap.second, cpuInfo.groupMap));
-                updateMap(pMap, calculateCoreNum(pMap));
+                int coreNum = calculateCoreNum(pMap);
+                coreList.push_back(coreNum + offset);
+                updateMap(pMap, coreNum);
             }
         }
     }
@@ -348,10 +403,9 @@ class AffinityVector
             if (skipMask(pMap[coreId], maskIndex[coreId], processorMap[coreId]))
                 continue;
 
-            procVect.push_back(
-                calculateCoreNum(pMap[coreId])
-                + calculateOffset(pMap[coreId].second, cpuInfo.groupMap));
-            updateMap(pMap[coreId], calculateCoreNum(pMap[coreId]));
+            int coreNum = calculateCoreNum(pMap[coreId]);
+            procVect.push_back(coreNum + calculateOffset(pMap[coreId].second));
+            updateMap(pMap[coreId], coreNum);
 
             threadId++;
             if (threadId == threadCount)
@@ -359,9 +413,175 @@ class AffinityVector
         }
     }
 
+    /**
+     * @brief           Get the logical cores of a domain
+     *
+     * @details         This function lists the logical cores of a NUMA node
+     *                  or cache, one per physical core first, then the SMT
+     *                  siblings.
+     *
+     * @param[in]       domain      Processor map of the node or cache
+     *
+     * @param[out]      coreList    List of core numbers
+     *
+     * @return          void
+     */
+    void getDomainCoreList(const std::vector<CoreMask>& domain,
+                           std::vector<int>&            coreList)
+    {
+        std::vector<int> nodeList;
+        coreMapToCoreList(domain, nodeList);
+
+        std::vector<bool> inNode;
+        for (int cpu : nodeList) {
+            if (inNode.size() <= size_t(cpu))
+                inNode.resize(cpu + 1, false);
+            inNode[cpu] = true;
+        }
+        auto outsideNode = [&](int cpu) {
+            return size_t(cpu) >= inNode.size() || !inNode[cpu];
+        };
+        std::vector<std::vector<int>> cores;
+        for (const auto& core : cpuInfo.processorMap) {
+            std::vector<int> siblings;
+            coreMapToCoreList(core, siblings);
+            siblings.erase(
+                std::remove_if(siblings.begin(), siblings.end(), outsideNode),
+                siblings.end());
+            if (siblings.size() != 0)
+                cores.push_back(siblings);
+        }
+        if (cores.size() == 0) {
+            // No core information for this domain
+            coreList.insert(coreList.end(), nodeList.begin(), nodeList.end());
+            return;
+        }
+
+        size_t added = 1;
+        for (size_t sibling = 0; added != 0; sibling++) {
+            added = 0;
+            for (const auto& core : cores) {
+                if (sibling < core.size()) {
+                    coreList.push_back(core[sibling]);
+                    added++;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief           Get the logical cores of a NUMA node
+     *
+     * @details         See getDomainCoreList().
+     *
+     * @param[in]       node        NUMA node number
+     *
+     * @param[out]      coreList    List of core numbers
+     *
+     * @return          void
+     */
+    void getNodeCoreList(size_t node, std::vector<int>& coreList)
+    {
+        getDomainCoreList(cpuInfo.nodeMap[node], coreList);
+    }
+
+    /**
+     * @brief           Get the cache compact affinity vector
+     *
+     * @details         This function fills the caches of a level one after
+     *                  the other, e.g. one CCX before the next for level 3,
+     *                  each with one thread per physical core first and then
+     *                  the SMT siblings.
+     *
+     * @param[out]      procVect    Vector to store the affinity
+     *
+     * @param[in]       cacheLevel  Cache level, 1 to 3
+     *
+     * @return          void
+     */
+    void getCacheCompactAffinityVector(std::vector<int>& procVect,
+                                       int               cacheLevel)
+    {
+        std::vector<int> coreList;
+        for (const auto& cache : getCacheLevelMap(cacheLevel)) {
+            getDomainCoreList(cache, coreList);
+        }
+        if (coreList.size() == 0) {
+            getCoreAffinityVector(procVect);
+            return;
+        }
+        for (size_t thread = 0; thread < procVect.size(); thread++) {
+            procVect[thread] = coreList[thread % coreList.size()];
+        }
+    }
+
+    /**
+     * @brief           Get the NUMA compact affinity vector
+     *
+     * @details         This function fills one NUMA node after the other,
+     *                  each with one thread per physical core first and then
+     *                  the SMT siblings, so the threads share as few memory
+     *                  domains as possible.
+     *
+     * @param[out]      procVect    Vector to store the affinity
+     *
+     * @return          void
+     */
+    void getNumaCompactAffinityVector(std::vector<int>& procVect)
+    {
+        std::vector<int> coreList;
+        for (size_t node = 0; node < cpuInfo.nodeMap.size(); node++) {
+            getNodeCoreList(node, coreList);
+        }
+        if (coreList.size() == 0) {
+            getCoreAffinityVector(procVect);
+            return;
+        }
+        for (size_t thread = 0; thread < procVect.size(); thread++) {
+            procVect[thread] = coreList[thread % coreList.size()];
+        }
+    }
+
+    /**
+     * @brief           Get the NUMA spread affinity vector
+     *
+     * @details         This function splits the threads into contiguous,
+     *                  equally sized blocks, one per NUMA node, and spreads
+     *                  each block over the physical cores of its node.
+     *
+     * @param[out]      procVect    Vector to store the affinity
+     *
+     * @return          void
+     */
+    void getNumaSpreadAffinityVector(std::vector<int>& procVect)
+    {
+        std::vector<std::vector<int>> nodes;
+        for (size_t node = 0; node < cpuInfo.nodeMap.size(); node++) {
+            std::vector<int> coreList;
+            getNodeCoreList(node, coreList);
+            if (coreList.size() != 0)
+                nodes.push_back(coreList);
+        }
+        if (nodes.size() == 0 || procVect.size() == 0) {
+            getCoreAffinityVector(procVect);
+            return;
+        }
+
+        int              threadCount = procVect.size();
+        std::vector<int> nodeVect(threadCount);
+        createVector(nodeVect, 0, threadCount - 1, 0, nodes.size() - 1);
+        std::vector<size_t> used(nodes.size(), 0);
+        for (int thread = 0; thread < threadCount; thread++) {
+            int         node     = nodeVect[thread];
+            const auto& coreList = nodes[node];
+            procVect[thread]     = coreList[used[node]++ % coreList.size()];
+        }
+    }
+
   public:
     AffinityVector(const CpuTopology& Info = CpuTopology::get())
         : cpuInfo{ Info }
+        , groupOffsets{ calculateOffsets(Info.groupMap) }
     {
     }
 
@@ -369,20 +589,24 @@ class AffinityVector
      * @brief           Get the spread affinity vector
      *
      * @details         This function creates a vector that maps the threads to
-     *                  cache groups.
+     *                  cache groups, e.g. one thread per L2 for level 2.
      *
      * @param[out]      procVect    Vector to store the spread affinity
      *
+     * @param[in]       cacheLevel  Cache level to spread over, 1 to 3
+     *
      * @return          void
      */
-    void getSpreadAffinityVectory(std::vector<int>& procVect)
+    void getSpreadAffinityVectory(std::vector<int>& procVect,
+                                  int               cacheLevel = 3)
     {
+        const auto&                     caches = getCacheLevelMap(cacheLevel);
         std::map<int, std::vector<int>> cacheMap;
-        getCacheAffinityMap(procVect.size(), cacheMap);
+        getCacheAffinityMap(procVect.size(), caches, cacheMap);
 
         for (auto& cache : cacheMap) {
-            if (cpuInfo.cacheMap.size() != 0){
-                auto             processorMap = cpuInfo.cacheMap[cache.first];
+            if (caches.size() != 0){
+                auto             processorMap = caches[cache.first];
                 std::vector<int> coreList;
                 coreMapToCoreList(processorMap, coreList);
 
@@ -442,9 +666,22 @@ class AffinityVector
     {
         int threadCount = procVect.size();
 
+        // The processors the process may use, which need not be 0 to
+        // active_processors - 1
+        std::vector<int> coreList;
+        for (const auto& core : cpuInfo.processorMap) {
+            coreMapToCoreList(core, coreList);
+        }
+        std::sort(coreList.begin(), coreList.end());
+        coreList.erase(std::unique(coreList.begin(), coreList.end()),
+                       coreList.end());
+
         procVect.clear();
         for (int threadId = 0; threadId < threadCount; threadId++) {
-            procVect.push_back(threadId % cpuInfo.active_processors);
+            if (coreList.size() != 0)
+                procVect.push_back(coreList[threadId % coreList.size()]);
+            else
+                procVect.push_back(threadId % cpuInfo.active_processors);
         }
     }
 
@@ -454,18 +691,23 @@ class AffinityVector
      * @details        Get the affinity vector based on the pinning strategy
      *
      * @param[in]      pinStrategyIndex  0 - spread , 1 - Core, 2 - Logical
-     *                 Processor
+     *                 Processor, 3 - NUMA compact, 4 - NUMA spread, 5 - Cache
+     *                 compact
      *
      * @param[out]     processPinGroup   Vector to store the affinity vector
      *
+     * @param[in]      cacheLevel        Cache level of spread and cache
+     *                 compact, 1 to 3
+     *
      * @return         None
      */
     void getAffinityVector(std::vector<int>& processPinGroup,
-                           int               pinStrategyIndex)
+                           int               pinStrategyIndex,
+                           int               cacheLevel = 3)
     {
         switch (pinStrategyIndex) {
             case pinStrategy::SPREAD:
-                getSpreadAffinityVectory(processPinGroup);
+                getSpreadAffinityVectory(processPinGroup, cacheLevel);
                 break;
             case pinStrategy::CORE:
                 getCoreAffinityVector(processPinGroup);
@@ -473,60 +715,158 @@ class AffinityVector
             case pinStrategy::LOGICAL:
                 getLogicalAffinityVector(processPinGroup);
                 break;
+            case pinStrategy::NUMA_COMPACT:
+                getNumaCompactAffinityVector(processPinGroup);
+                break;
+            case pinStrategy::NUMA_SPREAD:
+                getNumaSpreadAffinityVector(processPinGroup);
+                break;
+            case pinStrategy::CACHE_COMPACT:
+                getCacheCompactAffinityVector(processPinGroup, cacheLevel);
+                break;
             default:
                 break;
         }
     }
 
-    /** @brief         setAffinity
+    /**
+     * @brief          getNumaNodes
      *
-     * @details       Pin Threads to a specific processor group.
+     * @details        Get the NUMA node of every processor in an affinity
+     *                 vector, e.g. to first-touch the data of each thread on
+     *                 its node.
      *
-     * @param[in]     threadList        ThreadIds to pin
+     * @param[in]      processPinGroup   Affinity vector
      *
-     * @param[in]     processorList    List of processors to pin the threads
+     * @param[out]     numaNodes         NUMA node per entry, -1 if unknown
+     *
+     * @return         None
      */
-    void setAffinity(std::vector<pthread_t> const& threadList,
-                     std::vector<int> const&       processorList)
+    void getNumaNodes(std::vector<int> const& processPinGroup,
+                      std::vector<int>&       numaNodes)
     {
-        for (size_t i = 0; i < threadList.size(); i++) {
-            // Pin the thread to the processor
-            AUD_ASSERT(processorList[i] < std::thread::hardware_concurrency(),
-                       "Invalid processor Id");
+        std::vector<int> nodeOf;
+        for (size_t node = 0; node < cpuInfo.nodeMap.size(); node++) {
+            std::vector<int> nodeList;
+            coreMapToCoreList(cpuInfo.nodeMap[node], nodeList);
+            for (int cpu : nodeList) {
+                if (nodeOf.size() <= size_t(cpu))
+                    nodeOf.resize(cpu + 1, -1);
+                nodeOf[cpu] = node;
+            }
+        }
+
+        numaNodes.clear();
+        for (int cpu : processPinGroup) {
+            bool known = cpu >= 0 && size_t(cpu) < nodeOf.size();
+            numaNodes.push_back(known ? nodeOf[cpu] : -1);
+        }
+    }
+
+    /**
+     * @brief         isAllowed
+     *
+     * @details       Check if the process may run on a processor, i.e. if it
+     *                is in the groupMap.
+     *
+     * @param[in]     processor    Processor number
+     *
+     * @return        true if the processor is allowed
+     */
+    bool isAllowed(int processor)
+    {
+        for (size_t group = 0; group < cpuInfo.groupMap.size(); group++) {
+            int first = groupOffsets[group];
+            int count = cpuInfo.groupMap[group].second;
+            if (processor < first || processor >= first + count)
+                continue;
+            return (cpuInfo.groupMap[group].first >> (processor - first)) & 1;
+        }
+        return false;
+    }
+
+    /**
+     * @brief         pinThread
+     *
+     * @details       Pin a single thread to a processor.
+     *
+     * @param[in]     thread       ThreadId to pin
+     *
+     * @param[in]     processor    Processor to pin the thread to
+     *
+     * @return        StatusOk() if the affinity was set, InvalidArgument if
+     *                the processor is outside the allowed set of the process
+     */
+    Status pinThread(pthread_t thread, int processor)
+    {
+        if (processor < 0 || !isAllowed(processor))
+            return StatusInvalidArgument(
+                "processor " + std::to_string(processor)
+                + " is not in the allowed set of the process");
 #ifdef __linux__
-            cpu_set_t cpuset;
-            CPU_ZERO(&cpuset);
-            CPU_SET(processorList[i], &cpuset);
-            pthread_setaffinity_np(threadList[i], sizeof(cpu_set_t), &cpuset);
+        // cpu_set_t holds CPU_SETSIZE (1024) processors, size the set for
+        // the processor instead
+        size_t     size   = CPU_ALLOC_SIZE(processor + 1);
+        cpu_set_t* cpuset = CPU_ALLOC(processor + 1);
+        if (cpuset == NULL)
+            return StatusInternalError("CPU_ALLOC failed");
+        CPU_ZERO_S(size, cpuset);
+        CPU_SET_S(processor, size, cpuset);
+        int err = pthread_setaffinity_np(thread, size, cpuset);
+        CPU_FREE(cpuset);
+        if (err != 0)
+            return StatusInternalError(
+                std::string("pthread_setaffinity_np: ") + strerror(err));
+        return StatusOk();
 #else
-            GROUP_AFFINITY groupAffinity;
-            ZeroMemory(&groupAffinity, sizeof(GROUP_AFFINITY));
-            // calculate the group and mask from the processor number and
-            // cpuInfo.groupMap
-            int core  = 0;
-            int group = 0;
-            for (auto gMap : cpuInfo.groupMap) {
-                if (processorList[i] > core + gMap.second - 1) {
-                    core = core + gMap.second;
-                    group++;
-                } else {
-                    break;
-                }
+        GROUP_AFFINITY groupAffinity;
+        ZeroMemory(&groupAffinity, sizeof(GROUP_AFFINITY));
+        // calculate the group and mask from the processor number and
+        // cpuInfo.groupMap
+        int core  = 0;
+        int group = 0;
+        for (auto gMap : cpuInfo.groupMap) {
+            if (processor > core + gMap.second - 1) {
+                core = core + gMap.second;
+                group++;
+            } else {
+                break;
             }
+        }
 
-            groupAffinity.Mask  = 1ull << (processorList[i] - core);
-            groupAffinity.Group = group;
-            HANDLE hThread      = (HANDLE)threadList[i];
-            auto   result =
-                SetThreadGroupAffinity(hThread, &groupAffinity, nullptr);
-            if (!result) {
-                std::cout << "SetThreadGroupAffinity Failed\n";
-            }
+        groupAffinity.Mask  = 1ull << (processor - core);
+        groupAffinity.Group = group;
+        HANDLE hThread      = (HANDLE)thread;
+        if (!SetThreadGroupAffinity(hThread, &groupAffinity, nullptr))
+            return StatusInternalError(
+                "SetThreadGroupAffinity: error "
+                + std::to_string(GetLastError()));
+        return StatusOk();
 #endif
-        std::cout << "Thread " << threadList[i] << " is pinned to processor "
-                  << processorList[i] << std::endl;
+    }
 
+    /** @brief         setAffinity
+     *
+     * @details       Pin Threads to a specific processor group.
+     *
+     * @param[in]     threadList        ThreadIds to pin
+     *
+     * @param[in]     processorList    List of processors to pin the threads
+     *
+     * @return        StatusOk() if every thread was pinned, otherwise the
+     *                first failure; the remaining threads are still pinned
+     */
+    Status setAffinity(std::vector<pthread_t> const& threadList,
+                       std::vector<int> const&       processorList)
+    {
+        Status status = StatusOk();
+        for (size_t i = 0; i < threadList.size(); i++) {
+            // Pin the thread to the processor, keep the first failure
+            Status pinned = pinThread(threadList[i], processorList[i]);
+            if (!pinned.ok())
+                status.update(pinned);
         }
+        return status;
     }
 };
 } // namespace Au
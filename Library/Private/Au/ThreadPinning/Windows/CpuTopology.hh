@@ -21,6 +21,7 @@
  */
 #pragma once
 #include "Au/Config.h"
+#include <algorithm>
 #include <bitset>
 #include <cmath>
 #include <iostream>
@@ -32,6 +33,22 @@
 namespace Au {
 typedef std::pair<KAFFINITY, int> CoreMask;
 using SLPIEX = SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX;
+
+/* Kind of a cache, numbered like PROCESSOR_CACHE_TYPE */
+enum class CacheType
+{
+    eUnified     = CacheUnified,
+    eInstruction = CacheInstruction,
+    eData        = CacheData
+};
+
+/* The caches of one level and type and the processors sharing each */
+struct CacheLevel
+{
+    int                                level;
+    CacheType                          type;
+    std::vector<std::vector<CoreMask>> map;
+};
 // if compiler is msvc
 /**
  * @brief       Advance a pointer by a number of bytes.
@@ -128,11 +145,39 @@ class LogicalProcessorInformation
 
 class CpuTopology
 {
+  private:
+    /**
+     * @brief            Add a cache to the caches of its level and type.
+     *
+     * @param[in]        int level, PROCESSOR_CACHE_TYPE type
+     * @param[in]        const std::vector<CoreMask>& cachePMap
+     *
+     * @return           void
+     */
+    void addCache(int                          level,
+                  PROCESSOR_CACHE_TYPE         type,
+                  const std::vector<CoreMask>& cachePMap)
+    {
+        if (type == CacheTrace || cachePMap.size() == 0)
+            return;
+        auto cache = std::find_if(
+            caches.begin(), caches.end(), [&](const CacheLevel& c) {
+                return c.level == level && c.type == CacheType(type);
+            });
+        if (cache == caches.end())
+            cache = caches.insert(
+                caches.end(), CacheLevel{ level, CacheType(type), {} });
+        cache->map.push_back(cachePMap);
+    }
+
   public:
     uint32_t                           active_processors;
     std::vector<std::vector<CoreMask>> processorMap;
     std::vector<std::vector<CoreMask>> cacheMap;
     std::vector<CoreMask>              groupMap;
+    std::vector<std::vector<CoreMask>> nodeMap;
+    /* Every cache level and type */
+    std::vector<CacheLevel> caches;
 
     static const CpuTopology& get()
     {
@@ -145,11 +190,14 @@ class CpuTopology
         , processorMap{}
         , cacheMap{}
         , groupMap{}
+        , nodeMap{}
+        , caches{}
     {
         active_processors = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
         LogicalProcessorInformation processorInfo(RelationProcessorCore);
         LogicalProcessorInformation cacheInfo(RelationCache);
         LogicalProcessorInformation groupInfo(RelationGroup);
+        LogicalProcessorInformation nodeInfo(RelationNumaNode);
 
 #ifdef AU_COMPILER_IS_MSVC
         for (; auto pInfo = processorInfo.Current(); processorInfo.MoveNext()) {
@@ -160,15 +208,16 @@ class CpuTopology
         }
 
         for (; auto cInfo = cacheInfo.Current(); cacheInfo.MoveNext()) {
-            // Collect the L3 Cache --> Logical core mapping
+            // Collect the Cache --> Logical core mapping of every level
+            std::vector<CoreMask> cachePMap;
+            for (auto i = 0; i < cInfo->u.Cache.GroupCount; i++)
+                cachePMap.push_back(
+                    std::make_pair(cInfo->u.Cache.u.GroupMasks[i].Mask,
+                                   cInfo->u.Cache.u.GroupMasks[i].Group));
+            addCache(cInfo->u.Cache.Level, cInfo->u.Cache.Type, cachePMap);
             if (cInfo->u.Cache.Level == 3
                 && (cInfo->u.Cache.Type == CacheData
                     || cInfo->u.Cache.Type == CacheUnified)) {
-                std::vector<CoreMask> cachePMap;
-                for (auto i = 0; i < cInfo->u.Cache.GroupCount; i++)
-                    cachePMap.push_back(
-                        std::make_pair(cInfo->u.Cache.u.GroupMasks[i].Mask,
-                                       cInfo->u.Cache.u.GroupMasks[i].Group));
                 if (cachePMap.size() != 0)
                     cacheMap.push_back(cachePMap);
             }
@@ -180,6 +229,15 @@ class CpuTopology
                     gInfo->u.Group.GroupInfo[i].ActiveProcessorMask,
                     gInfo->u.Group.GroupInfo[i].ActiveProcessorCount));
         }
+        for (; auto nInfo = nodeInfo.Current(); nodeInfo.MoveNext()) {
+            // Collect the NUMA node --> Logical core mapping
+            size_t node = nInfo->u.NumaNode.NodeNumber;
+            if (nodeMap.size() <= node)
+                nodeMap.resize(node + 1);
+            nodeMap[node].push_back(
+                std::make_pair(nInfo->u.NumaNode.u.GroupMask.Mask,
+                               nInfo->u.NumaNode.u.GroupMask.Group));
+        }
 #else
         for (; auto pInfo = processorInfo.Current(); processorInfo.MoveNext()) {
             // Collect the physical core -> logical core mapping
@@ -189,15 +247,16 @@ class CpuTopology
         }
 
         for (; auto cInfo = cacheInfo.Current(); cacheInfo.MoveNext()) {
-            // Collect the L3 Cache --> Logical core mapping
+            // Collect the Cache --> Logical core mapping of every level
             std::vector<CoreMask> cachePMap;
+            for (auto i = 0; i < cInfo->Cache.GroupCount; i++)
+                cachePMap.push_back(
+                    std::make_pair(cInfo->Cache.GroupMasks[i].Mask,
+                                   cInfo->Cache.GroupMasks[i].Group));
+            addCache(cInfo->Cache.Level, cInfo->Cache.Type, cachePMap);
             if (cInfo->Cache.Level == 3
                 && (cInfo->Cache.Type == CacheData
                     || cInfo->Cache.Type == CacheUnified)) {
-                for (auto i = 0; i < cInfo->Cache.GroupCount; i++)
-                    cachePMap.push_back(
-                        std::make_pair(cInfo->Cache.GroupMasks[i].Mask,
-                                       cInfo->Cache.GroupMasks[i].Group));
                 if (cachePMap.size() != 0)
                     cacheMap.push_back(cachePMap);
             }
@@ -209,6 +268,15 @@ class CpuTopology
                     gInfo->Group.GroupInfo[i].ActiveProcessorMask,
                     gInfo->Group.GroupInfo[i].ActiveProcessorCount));
         }
+        for (; auto nInfo = nodeInfo.Current(); nodeInfo.MoveNext()) {
+            // Collect the NUMA node --> Logical core mapping
+            size_t node = nInfo->NumaNode.NodeNumber;
+            if (nodeMap.size() <= node)
+                nodeMap.resize(node + 1);
+            nodeMap[node].push_back(
+                std::make_pair(nInfo->NumaNode.GroupMask.Mask,
+                               nInfo->NumaNode.GroupMask.Group));
+        }
 #endif
     }
 };
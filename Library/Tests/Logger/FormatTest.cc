@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "Au/Logger/LogManager.hh"
+#include "Au/Logger/Macros.hh"
+
+#include <gtest/gtest.h>
+
+using namespace Au::Logger;
+
+namespace {
+
+// Encodes the arguments the way au_logger_logf() does
+String
+encodeFormat(const char* format, ...)
+{
+    String  buf;
+    va_list args;
+    va_start(args, format);
+    encodeVarArgs(buf, format, args);
+    va_end(args);
+    return buf;
+}
+
+TEST(FormatTest, FormatDeferred)
+{
+    EXPECT_EQ(formatDeferred("plain text", encodeArgs()), "plain text");
+    EXPECT_EQ(formatDeferred("%d %u %x", encodeArgs(-3, 7u, 255)), "-3 7 ff");
+    EXPECT_EQ(formatDeferred("%lld|%5d|%-4d|", encodeArgs(1LL << 40, 42, 7)),
+              "1099511627776|   42|7   |");
+    EXPECT_EQ(formatDeferred("%.3f %g", encodeArgs(3.14159, 0.5f)),
+              "3.142 0.5");
+    EXPECT_EQ(formatDeferred("%s and %s", encodeArgs("abc", String("def"))),
+              "abc and def");
+    EXPECT_EQ(formatDeferred("[%5s]", encodeArgs("ab")), "[   ab]");
+    EXPECT_EQ(formatDeferred("%c%c", encodeArgs('o', 'k')), "ok");
+    EXPECT_EQ(formatDeferred("100%%", encodeArgs()), "100%");
+
+    // Argument type wins over the conversion
+    EXPECT_EQ(formatDeferred("%d", encodeArgs(2.5)), "2");
+    EXPECT_EQ(formatDeferred("%s", encodeArgs(12)), "12");
+
+    // Missing arguments keep the conversion, extra ones are ignored
+    EXPECT_EQ(formatDeferred("%d %d", encodeArgs(1)), "1 %d");
+    EXPECT_EQ(formatDeferred("%d", encodeArgs(1, 2)), "1");
+
+    const char* null = nullptr;
+    EXPECT_EQ(formatDeferred("%s", encodeArgs(null)), "(null)");
+
+    // Arguments from a va_list, the grouping flag is passed to snprintf
+    const char* grouped = "%'d items";
+    char        expected[32];
+    std::snprintf(expected, sizeof(expected), grouped, 1000);
+    EXPECT_EQ(formatDeferred(grouped, encodeFormat(grouped, 1000)), expected);
+    EXPECT_EQ(formatDeferred("%-5ld|%s",
+                             encodeFormat("%-5ld|%s", 12L, "text")),
+              "12   |text");
+}
+
+TEST(FormatTest, FormatRegistry)
+{
+    auto& registry = FormatRegistry::get();
+    EXPECT_EQ(registry.getFormat(FormatRegistry::cPlainTextId), "%s");
+
+    Au::Uint32 id = registry.registerFormat("registry %d");
+    EXPECT_NE(id, FormatRegistry::cPlainTextId);
+    EXPECT_EQ(registry.getFormat(id), "registry %d");
+    EXPECT_GT(registry.getCount(), id);
+    EXPECT_EQ(registry.getFormat(registry.getCount()), "");
+}
+
+TEST(FormatTest, DeferredMessage)
+{
+    Au::Uint32 id = FormatRegistry::get().registerFormat("n=%d name=%s");
+    Priority   p(Priority::PriorityLevel::eWarning);
+    Message    msg = Message::deferred(id, p, 42, "dgemm");
+
+    EXPECT_TRUE(msg.isDeferred());
+    EXPECT_EQ(msg.getFormatId(), id);
+    EXPECT_EQ(msg.getText(), "n=42 name=dgemm");
+    EXPECT_NE(msg.getMsg().find("Warning"), std::string::npos);
+    EXPECT_NE(msg.getMsg().find("n=42 name=dgemm"), std::string::npos);
+
+    Message plain("plain");
+    EXPECT_FALSE(plain.isDeferred());
+    EXPECT_EQ(plain.getText(), "plain");
+    EXPECT_EQ(plain.getPayload(), "plain");
+}
+
+TEST(FormatTest, BinaryFileLoggerRoundTrip)
+{
+    const std::string testFilename = "test_binary_logger.bin";
+    std::remove(testFilename.c_str());
+
+    Au::Uint32 id = FormatRegistry::get().registerFormat("m=%d x=%.2f");
+    // Two sessions, each with its own format table
+    for (int session = 0; session < 2; session++) {
+        LogWriter::setLogger(
+            LoggerFactory::createLogger("BinaryFileLogger", testFilename));
+        auto logWriter = LogWriter::getLogWriter();
+        EXPECT_NO_THROW(LoggerFactory::validateLoggerType("BinaryFileLogger"));
+
+        Priority             p(Priority::PriorityLevel::eDebug);
+        std::vector<Message> msgs;
+        msgs.push_back(Message::deferred(id, p, session, 1.5));
+        msgs.emplace_back("plain text " + std::to_string(session));
+        logWriter->log(msgs);
+        logWriter->stop();
+    }
+
+    std::ifstream      infile(testFilename, std::ios::binary);
+    std::ostringstream contents;
+    contents << infile.rdbuf();
+    infile.close();
+
+    std::vector<Message> msgs;
+    ASSERT_TRUE(BinaryLogDecoder::decode(contents.str(), msgs));
+    ASSERT_EQ(msgs.size(), 4u);
+    EXPECT_EQ(msgs[0].getText(), "m=0 x=1.50");
+    EXPECT_EQ(msgs[0].getPriority().toStr(), "Debug");
+    EXPECT_EQ(msgs[1].getText(), "plain text 0");
+    EXPECT_EQ(msgs[1].getPriority().toStr(), "Info");
+    EXPECT_EQ(msgs[2].getText(), "m=1 x=1.50");
+    EXPECT_EQ(msgs[3].getText(), "plain text 1");
+
+    std::ostringstream text;
+    EXPECT_TRUE(BinaryLogDecoder::decodeFile(testFilename, text));
+    EXPECT_NE(text.str().find("Debug   : m=1 x=1.50\n"), std::string::npos);
+
+    // Truncated file keeps what could be decoded
+    msgs.clear();
+    String truncated = contents.str();
+    truncated.resize(truncated.size() - 3);
+    EXPECT_FALSE(BinaryLogDecoder::decode(truncated, msgs));
+    EXPECT_EQ(msgs.size(), 3u);
+
+    EXPECT_FALSE(BinaryLogDecoder::decode("not a log", msgs));
+
+    std::remove(testFilename.c_str());
+}
+
+TEST(FormatTest, LogfMacro)
+{
+    const std::string testFilename = "test_logf_macro.log";
+    std::remove(testFilename.c_str());
+
+    LogWriter::setLogger(LoggerFactory::createLogger("FileLogger", testFilename));
+    AU_LOGGER_LOGF(eError, "kernel %s failed with %d", "zgemm", -2);
+    LogWriter::shutdown();
+
+    std::ifstream infile(testFilename);
+    std::string   content((std::istreambuf_iterator<char>(infile)),
+                        std::istreambuf_iterator<char>());
+    EXPECT_NE(content.find("Error   : kernel zgemm failed with -2"),
+              std::string::npos);
+
+    std::remove(testFilename.c_str());
+}
+
+TEST(FormatTest, StructuredFields)
+{
+    int      value = 7;
+    Priority p(Priority::PriorityLevel::eInfo);
+    Message  msg("Kernel done", p);
+    EXPECT_FALSE(msg.hasFields());
+    msg.addFields("kernel", "dgemm", "m", 512, "n", -3, "time", 1.5)
+        .addField("ptr", &value)
+        .addField("note", std::string("two words"));
+    EXPECT_TRUE(msg.hasFields());
+    EXPECT_EQ(msg.getPayload(), "Kernel done");
+    EXPECT_EQ(msg.getText(), "Kernel done");
+
+    std::vector<Field> fields;
+    ASSERT_TRUE(msg.getFields(fields));
+    ASSERT_EQ(fields.size(), 6u);
+    EXPECT_EQ(fields[0].key, "kernel");
+    EXPECT_EQ(fields[0].type, ArgType::eString);
+    EXPECT_EQ(fields[0].text, "dgemm");
+    EXPECT_EQ(fields[1].type, ArgType::eInt64);
+    EXPECT_EQ(fields[1].bits, 512u);
+    EXPECT_EQ(static_cast<Au::Int64>(fields[2].bits), -3);
+    EXPECT_EQ(fields[3].type, ArgType::eDouble);
+    EXPECT_EQ(fields[3].real, 1.5);
+    EXPECT_EQ(fields[4].type, ArgType::ePointer);
+
+    // Text loggers append the fields as key=value
+    Message copy = msg;
+    EXPECT_NE(copy.getMsg().find(
+                  ": Kernel done kernel=dgemm m=512 n=-3 time=1.5 ptr=0x"),
+              std::string::npos);
+    EXPECT_NE(copy.getMsg().find(" note=\"two words\""), std::string::npos);
+
+    // Fields of a deferred message follow its arguments
+    Au::Uint32 id = FormatRegistry::get().registerFormat("%d rows");
+    Message    deferred = Message::deferred(id, p, 10).addField("rank", 2);
+    EXPECT_EQ(deferred.getText(), "10 rows");
+    EXPECT_NE(deferred.getMsg().find("10 rows rank=2"), std::string::npos);
+}
+
+TEST(FormatTest, JsonFileLogger)
+{
+    const std::string testFilename = "test_json_logger.jsonl";
+    std::remove(testFilename.c_str());
+
+    LogWriter::setLogger(
+        LoggerFactory::createLogger("JsonFileLogger", testFilename));
+    EXPECT_NO_THROW(LoggerFactory::validateLoggerType("JsonFileLogger"));
+    AU_LOGGER_LOG_FIELDS(
+        eWarning, "Kernel done", "kernel", "dgemm", "m", 512, "time", 1.5);
+    AU_LOGGER_LOG_INFO("Quote \" and\ttab");
+    AU_LOGGER_LOG_FIELDS(eInfo, "Odd values", "bad", std::nan(""), "u", 7u);
+    LogWriter::shutdown();
+
+    std::ifstream            infile(testFilename);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(infile, line);) {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[0].rfind("{\"ts\":", 0), 0u);
+    EXPECT_NE(lines[0].find(",\"level\":\"Warning\",\"msg\":\"Kernel done\","
+                            "\"fields\":{\"kernel\":\"dgemm\",\"m\":512,"
+                            "\"time\":1.5}}"),
+              std::string::npos);
+    EXPECT_NE(lines[1].find("\"msg\":\"Quote \\\" and\\ttab\"}"),
+              std::string::npos);
+    EXPECT_NE(lines[2].find("\"fields\":{\"bad\":null,\"u\":7}"),
+              std::string::npos);
+
+    std::remove(testFilename.c_str());
+}
+
+TEST(FormatTest, BinaryFileLoggerFields)
+{
+    const std::string testFilename = "test_binary_fields.bin";
+    std::remove(testFilename.c_str());
+
+    LogWriter::setLogger(
+        LoggerFactory::createLogger("BinaryFileLogger", testFilename));
+    AU_LOGGER_LOG_FIELDS(eInfo, "With fields", "cpu", 3, "name", "worker");
+    AU_LOGGER_LOG_INFO("Without fields");
+    LogWriter::shutdown();
+
+    std::ifstream      infile(testFilename, std::ios::binary);
+    std::ostringstream contents;
+    contents << infile.rdbuf();
+
+    std::vector<Message> msgs;
+    ASSERT_TRUE(BinaryLogDecoder::decode(contents.str(), msgs));
+    ASSERT_EQ(msgs.size(), 2u);
+    EXPECT_NE(msgs[0].getMsg().find("With fields cpu=3 name=worker"),
+              std::string::npos);
+    EXPECT_FALSE(msgs[1].hasFields());
+
+    std::remove(testFilename.c_str());
+}
+
+} // namespace
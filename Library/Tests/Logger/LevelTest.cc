@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Compile out everything below eWarning in this translation unit, and the
+// trace spans
+#define AU_LOGGER_MIN_LEVEL 8
+#define AU_TRACE_ENABLED    0
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Au/Logger/LogManager.hh"
+#include "Au/Logger/Macros.hh"
+#include "Au/Logger/Trace.hh"
+
+#include <gtest/gtest.h>
+
+using namespace Au::Logger;
+
+namespace {
+
+class RecordingLogger : public GenericLogger
+{
+  public:
+    explicit RecordingLogger(std::shared_ptr<std::vector<std::string>> texts)
+        : GenericLogger()
+        , m_texts{ std::move(texts) }
+    {
+        setLoggerName("RecordingLogger");
+    }
+    void write(const Message& msg) override
+    {
+        m_texts->push_back(msg.getText());
+    }
+    void        flush() override {}
+    std::string getLoggerType() const override { return "RecordingLogger"; }
+
+  private:
+    std::shared_ptr<std::vector<std::string>> m_texts;
+};
+
+std::string
+countedText(int& evaluations, const char* text)
+{
+    evaluations++;
+    return text;
+}
+
+TEST(LevelTest, CompileTimeLevel)
+{
+    static_assert(AU_LOGGER_LEVEL_ENABLED(eFatal));
+    static_assert(AU_LOGGER_LEVEL_ENABLED(eWarning));
+    static_assert(!AU_LOGGER_LEVEL_ENABLED(eNotice));
+    static_assert(!AU_LOGGER_LEVEL_ENABLED(eTrace));
+
+    auto texts = std::make_shared<std::vector<std::string>>();
+    int  evaluations = 0;
+
+    LogWriter::setLogger(std::make_unique<RecordingLogger>(texts));
+    AU_LOGGER_LOG_DEBUG(countedText(evaluations, "debug"));
+    AU_LOGGER_LOG_TRACE(countedText(evaluations, "trace"));
+    AU_LOGGER_LOGF(eInfo, "%s", countedText(evaluations, "info"));
+    EXPECT_EQ(evaluations, 0);
+
+    AU_LOGGER_LOG_WARN(countedText(evaluations, "warning"));
+    EXPECT_EQ(evaluations, 1);
+    LogWriter::getLogWriter()->flush();
+    ASSERT_EQ(texts->size(), 1u);
+    EXPECT_EQ(texts->front(), "warning");
+    LogWriter::shutdown();
+}
+
+TEST(LevelTest, RuntimeLevel)
+{
+    auto texts = std::make_shared<std::vector<std::string>>();
+    int  evaluations = 0;
+
+    EXPECT_EQ(LogWriter::getLevel(), Priority::PriorityLevel::eTrace);
+    LogWriter::setLevel(Priority::PriorityLevel::eError);
+    EXPECT_EQ(LogWriter::getLevel(), Priority::PriorityLevel::eError);
+    EXPECT_TRUE(LogWriter::isLevelEnabled(Priority::PriorityLevel::ePanic));
+    EXPECT_FALSE(LogWriter::isLevelEnabled(Priority::PriorityLevel::eWarning));
+
+    LogWriter::setLogger(std::make_unique<RecordingLogger>(texts));
+    AU_LOGGER_LOG_WARN(countedText(evaluations, "warning"));
+    AU_LOGGER_LOGF(eWarning, "%s", countedText(evaluations, "warning"));
+    EXPECT_EQ(evaluations, 0);
+
+    AU_LOGGER_LOG_ERROR(countedText(evaluations, "error"));
+    AU_LOGGER_LOGF(eFatal, "fatal %d", 1);
+    EXPECT_EQ(evaluations, 1);
+    LogWriter::getLogWriter()->flush();
+    ASSERT_EQ(texts->size(), 2u);
+    EXPECT_EQ((*texts)[0], "error");
+    EXPECT_EQ((*texts)[1], "fatal 1");
+
+    LogWriter::setLevel(Priority::PriorityLevel::eTrace);
+    LogWriter::shutdown();
+}
+
+TEST(LevelTest, TraceCompiledOut)
+{
+    Tracer::setEnabled(true);
+    size_t before = Tracer::get().getEventCount();
+    {
+        AU_TRACE_SCOPE("compiled out");
+    }
+    Tracer::setEnabled(false);
+    EXPECT_EQ(Tracer::get().getEventCount(), before);
+}
+
+} // namespace
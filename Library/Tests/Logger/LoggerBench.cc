@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Per-call latency and heap allocations of the logging macros. Built with
+ * AU_ENABLE_SLOW_TESTS.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Au/Logger.hh"
+#include "Au/Logger/LogManager.hh"
+#include "Au/Logger/Macros.hh"
+#include "Au/Logger/Trace.hh"
+
+#include <gtest/gtest.h>
+
+using namespace Au::Logger;
+
+namespace {
+// Heap allocations made by any thread of this program
+std::atomic<Au::Uint64> allocations{ 0 };
+} // namespace
+
+// Counting replacements of the global allocation functions, the array and
+// sized forms forward to these
+void*
+operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace {
+
+class NullLogger : public GenericLogger
+{
+  public:
+    void        write(const Message& msg) override {}
+    void        writeBatch(const std::vector<Message>& msgs) override {}
+    void        flush() override {}
+    std::string getLoggerType() const override { return "NullLogger"; }
+};
+
+constexpr int cIterations = 20000;
+
+template<typename Fn>
+double
+nsPerCall(Fn&& fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cIterations; i++) {
+        fn(i);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count()
+           / cIterations;
+}
+
+TEST(LoggerBench, MacroLatency)
+{
+    // What AU_LOGGER_LOG used to do: stop (and later restart) the writer
+    // thread on every call
+    double perCallStop = nsPerCall([](int i) {
+        LogWriter::setLogger(std::make_unique<NullLogger>());
+        AU_LOGGER_LOG_INFO("Benchmark message");
+        LogWriter::getLogWriter()->stop();
+    });
+
+    LogWriter::setLogger(std::make_unique<NullLogger>());
+    double persistent =
+        nsPerCall([](int i) { AU_LOGGER_LOG_INFO("Benchmark message"); });
+    LogWriter::getLogWriter()->flush();
+
+    double deferred = nsPerCall(
+        [](int i) { AU_LOGGER_LOGF(eInfo, "Benchmark message %d", i); });
+    LogWriter::getLogWriter()->flush();
+
+    LogWriter::setLevel(Priority::PriorityLevel::eWarning);
+    double filtered =
+        nsPerCall([](int i) { AU_LOGGER_LOG_INFO("Benchmark message"); });
+    LogWriter::setLevel(Priority::PriorityLevel::eTrace);
+    LogWriter::shutdown();
+
+    std::cout << "Stop per call      : " << perCallStop << " ns/call\n"
+              << "Persistent writer  : " << persistent << " ns/call\n"
+              << "Deferred (LOGF)    : " << deferred << " ns/call\n"
+              << "Filtered at runtime: " << filtered << " ns/call\n";
+
+    EXPECT_LT(persistent, perCallStop);
+}
+
+TEST(LoggerBench, MultiProducerContention)
+{
+    LogWriter::setLogger(std::make_unique<NullLogger>());
+    const int producers =
+        static_cast<int>(std::max(4u, std::thread::hardware_concurrency()));
+
+    // Mean ns per call of producers logging at the same time
+    auto contended = [producers](auto logCall) {
+        std::atomic<int>         ready{ 0 };
+        std::vector<double>      perCall(producers);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < producers; t++) {
+            threads.emplace_back([&, t] {
+                ready.fetch_add(1);
+                while (ready.load() < producers) {
+                    std::this_thread::yield();
+                }
+                perCall[t] = nsPerCall(logCall);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        LogWriter::getLogWriter()->flush();
+        return std::accumulate(perCall.begin(), perCall.end(), 0.0)
+               / producers;
+    };
+
+    // What the macros used to do: look the writer up under instanceMutex and
+    // copy its shared_ptr on every call
+    double locked = contended([](int i) {
+        LogManager logger(LogWriter::getLogWriter());
+        logger << Message("Benchmark message");
+    });
+    double lockFree =
+        contended([](int i) { AU_LOGGER_LOG_INFO("Benchmark message"); });
+    LogWriter::shutdown();
+
+    std::cout << "Producers          : " << producers << "\n"
+              << "Writer lookup lock : " << locked << " ns/call\n"
+              << "Thread local writer: " << lockFree << " ns/call\n";
+}
+
+TEST(LoggerBench, TimestampCost)
+{
+    volatile Au::Int64 sink    = 0;
+    double             capture = nsPerCall([&](int i) {
+        Timestamp ts;
+        sink = ts.getTicks();
+    });
+
+    // Formatting as done by the logging thread, one rebase per batch
+    std::vector<Message> msgs;
+    for (int i = 0; i < cIterations; i++) {
+        msgs.emplace_back("Benchmark message");
+    }
+    String buffer;
+    double format = nsPerCall([&](int i) {
+        if (i % 256 == 0) {
+            Timestamp::rebase();
+            buffer.clear();
+        }
+        msgs[i].appendMsg(buffer);
+    });
+
+    std::cout << "Timestamp capture  : " << capture << " ns/call\n"
+              << "Message formatting : " << format << " ns/call\n";
+}
+
+TEST(LoggerBench, SteadyStateAllocations)
+{
+    LogWriter::setLogger(std::make_unique<NullLogger>());
+    // Stored in a slab block rather than inline
+    const std::string longText(300, 'x');
+
+    auto logCalls = [&longText](int i) {
+        AU_LOGGER_LOG_INFO("Benchmark message, a typical log line of some "
+                           "sixty characters");
+        AU_LOGGER_LOGF(eInfo, "Iteration %d of %s", i, "benchmark");
+        AU_LOGGER_LOG_DEBUG(longText);
+    };
+
+    // Let the queue, batch vectors and slab pool reach their working size
+    nsPerCall(logCalls);
+    LogWriter::getLogWriter()->flush();
+
+    Au::Uint64 reserved = SlabAllocator::get().getReservedBytes();
+    Au::Uint64 before   = allocations.load();
+    double     perCall  = nsPerCall(logCalls);
+    LogWriter::getLogWriter()->flush();
+    Au::Uint64 allocated = allocations.load() - before;
+    LogWriter::shutdown();
+
+    std::cout << "Three log calls    : " << perCall << " ns\n"
+              << "Heap allocations   : " << allocated << " in "
+              << 3 * cIterations << " calls\n";
+
+    EXPECT_EQ(allocated, 0u);
+    EXPECT_EQ(SlabAllocator::get().getReservedBytes(), reserved);
+}
+
+TEST(LoggerBench, LegacyLoggerLatency)
+{
+    const std::string oldFile = "legacy_bench_old.txt";
+    const std::string newFile = "legacy_bench_new.txt";
+
+    // What Au::Logger::log() used to do with file logging on, less the
+    // console output
+    double synchronous = nsPerCall([&oldFile](int i) {
+        std::time_t now       = std::time(nullptr);
+        std::string timestamp = std::asctime(std::localtime(&now));
+        timestamp = timestamp.substr(0, timestamp.length() - 1);
+
+        std::stringstream stream;
+        stream << timestamp << " [INFO] "
+               << "Benchmark message" << " " << i;
+        std::ofstream logFile;
+        logFile.open(oldFile, std::ios_base::app);
+        if (logFile.is_open()) {
+            logFile << stream.str() << std::endl;
+        }
+    });
+
+    auto& legacy = Au::Logger::getInstance();
+    legacy.setLevel(Au::LogLevel::DEBUG);
+    LogWriter::setLogger(std::make_unique<FileLogger>(newFile));
+    double async = nsPerCall([&legacy](int i) {
+        legacy.log(Au::LogLevel::INFO, "Benchmark message", i);
+    });
+    LogWriter::shutdown();
+    legacy.setLevel(Au::LogLevel::CRITICAL);
+
+    std::remove(oldFile.c_str());
+    std::remove(newFile.c_str());
+
+    std::cout << "Legacy, synchronous: " << synchronous << " ns/call\n"
+              << "Legacy, LogWriter  : " << async << " ns/call\n";
+
+    EXPECT_LT(async, synchronous);
+}
+
+TEST(LoggerBench, TraceSpanCost)
+{
+    double off = nsPerCall([](int i) { AU_TRACE_SCOPE("Benchmark span"); });
+
+    Tracer::setEnabled(true);
+    // First span of the thread registers its buffer
+    nsPerCall([](int i) { AU_TRACE_SCOPE("Benchmark span"); });
+    double on = nsPerCall([](int i) { AU_TRACE_SCOPE("Benchmark span"); });
+    Tracer::setEnabled(false);
+    Tracer::get().clear();
+
+    std::cout << "Span, recording off: " << off << " ns/span\n"
+              << "Span, recording on : " << on << " ns/span\n";
+}
+
+} // namespace
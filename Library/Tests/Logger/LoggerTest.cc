@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -26,16 +26,36 @@
  *
  */
 
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <map>
+#include <sstream>
 #include <thread>
 
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "Au/Environ.hh"
+#include "Au/Logger.hh"
+#include "Au/Logger/FanOutLogger.hh"
 #include "Au/Logger/LogManager.hh"
+#include "Au/Logger/Macros.hh"
+#include "Capi/au/logger/logger.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 using namespace Au::Logger;
+using Au::Uint32;
 
 bool verbose = false;
 
@@ -313,6 +333,211 @@ TEST(LoggerTest, FileLoggerTest)
     std::remove(testFilename.c_str());
 }
 
+namespace fs = std::filesystem;
+
+// Fresh directory for rotated files, removed again by the destructor
+class ScratchDir
+{
+  public:
+    explicit ScratchDir(const std::string& name)
+        : m_path{ fs::temp_directory_path() / name }
+    {
+        fs::remove_all(m_path);
+        fs::create_directories(m_path);
+    }
+    ~ScratchDir() { fs::remove_all(m_path); }
+    std::string file(const std::string& name) const
+    {
+        return (m_path / name).string();
+    }
+    std::vector<std::string> list() const
+    {
+        std::vector<std::string> names;
+        for (const auto& entry : fs::directory_iterator(m_path)) {
+            names.push_back(entry.path().filename().string());
+        }
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+
+  private:
+    fs::path m_path;
+};
+
+std::string
+readFile(const std::string& filename)
+{
+    std::ifstream infile(filename);
+    return std::string((std::istreambuf_iterator<char>(infile)),
+                       std::istreambuf_iterator<char>());
+}
+
+TEST(LoggerTest, RotatingFileLoggerSizeTest)
+{
+    ScratchDir        dir("au_rotating_size_test");
+    const std::string filename = dir.file("app.log");
+
+    std::vector<std::string> rotatedFiles;
+    RotationPolicy           policy;
+    policy.maxFileSize = 300;
+    policy.maxFiles    = 3;
+    policy.onRotated   = [&rotatedFiles](const std::string& rotated) {
+        rotatedFiles.push_back(rotated);
+    };
+
+    {
+        RotatingFileLogger logger(filename, policy);
+        EXPECT_EQ(logger.getLoggerType(), "RotatingFileLogger");
+
+        std::vector<Message> msgs;
+        for (int i = 0; i < 40; i++) {
+            msgs.emplace_back("Rotating line " + std::to_string(i));
+        }
+        logger.writeBatch(msgs);
+        logger.write(Message("Single line"));
+        logger.waitForHousekeeping();
+
+        // Every file stays within the limit, only the newest three are kept
+        EXPECT_GE(rotatedFiles.size(), 4u);
+        auto names = dir.list();
+        ASSERT_EQ(names.size(), 4u);
+        EXPECT_EQ(names[0], "app.log");
+        for (const auto& name : names) {
+            EXPECT_LE(fs::file_size(dir.file(name)), policy.maxFileSize);
+        }
+        std::string newest = std::to_string(rotatedFiles.size());
+        EXPECT_EQ(names.back(), "app.log." + newest);
+        EXPECT_EQ(rotatedFiles.back(), filename + "." + newest);
+
+        // Nothing lost across the last rotation
+        std::string last = readFile(filename + "." + newest) + readFile(filename);
+        EXPECT_NE(last.find("Rotating line 39\n"), std::string::npos);
+        EXPECT_NE(last.find("Single line\n"), std::string::npos);
+    }
+
+    // Numbering continues after the files of an earlier run
+    size_t before = rotatedFiles.size();
+    {
+        RotatingFileLogger   logger(filename, policy);
+        std::vector<Message> msgs;
+        for (int i = 0; i < 10; i++) {
+            msgs.emplace_back("Second run line " + std::to_string(i));
+        }
+        logger.writeBatch(msgs);
+    }
+    ASSERT_GT(rotatedFiles.size(), before);
+    EXPECT_EQ(rotatedFiles[before],
+              filename + "." + std::to_string(before + 1));
+    EXPECT_EQ(dir.list().size(), 4u);
+}
+
+TEST(LoggerTest, RotatingFileLoggerAgeTest)
+{
+    ScratchDir        dir("au_rotating_age_test");
+    const std::string filename = dir.file("app.log");
+
+    RotationPolicy policy;
+    policy.maxFileSize = 0;
+    policy.maxFileAge  = std::chrono::seconds(1);
+    policy.maxFiles    = 0;
+
+    LogWriter::setLogger(std::make_unique<RotatingFileLogger>(filename, policy));
+    auto logWriter = LogWriter::getLogWriter();
+
+    std::vector<Message> msgs;
+    msgs.emplace_back("Before rotation");
+    logWriter->log(msgs);
+    logWriter->flush();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    msgs.clear();
+    msgs.emplace_back("After rotation");
+    logWriter->log(msgs);
+    logWriter->stop();
+
+    EXPECT_NE(readFile(filename + ".1").find("Before rotation"),
+              std::string::npos);
+    EXPECT_NE(readFile(filename).find("After rotation"), std::string::npos);
+    EXPECT_NO_THROW(LoggerFactory::validateLoggerType("RotatingFileLogger"));
+    EXPECT_EQ(LoggerFactory::createLogger("RotatingFileLogger", filename)
+                  ->getLoggerType(),
+              "RotatingFileLogger");
+}
+
+std::string
+dumpMapped(const std::string& filename)
+{
+    std::ostringstream out;
+    EXPECT_TRUE(MappedFileLogger::dump(filename, out));
+    return out.str();
+}
+
+TEST(LoggerTest, MappedFileLoggerWrapTest)
+{
+    ScratchDir        dir("au_mapped_wrap_test");
+    const std::string filename = dir.file("flight.log");
+
+    {
+        MappedFileLogger logger(filename, 4096);
+        EXPECT_EQ(logger.getCapacity() % 4096, 0u);
+        std::vector<Message> msgs;
+        for (int i = 0; i < 2000; i++) {
+            msgs.emplace_back("Record " + std::to_string(i));
+            if (msgs.size() == 16) {
+                logger.writeBatch(msgs);
+                msgs.clear();
+            }
+        }
+        logger.writeBatch(msgs);
+    }
+
+    // Only the newest records are kept, each of them complete
+    std::string text = dumpMapped(filename);
+    EXPECT_EQ(text.find("Record 0\n"), std::string::npos);
+    EXPECT_NE(text.find("Record 1999\n"), std::string::npos);
+    std::istringstream lines(text);
+    std::string        line;
+    while (std::getline(lines, line)) {
+        EXPECT_NE(line.find("Record "), std::string::npos) << line;
+    }
+
+    // Reopening with the same capacity continues the ring
+    {
+        MappedFileLogger logger(filename, 4096);
+        logger.write(Message("After reopen"));
+    }
+    text = dumpMapped(filename);
+    EXPECT_NE(text.find("Record 1999\n"), std::string::npos);
+    EXPECT_NE(text.find("After reopen\n"), std::string::npos);
+    EXPECT_GT(text.find("After reopen"), text.find("Record 1999"));
+
+    EXPECT_NO_THROW(LoggerFactory::validateLoggerType("MappedFileLogger"));
+    EXPECT_EQ(LoggerFactory::createLogger("MappedFileLogger", filename)
+                  ->getLoggerType(),
+              "MappedFileLogger");
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+TEST(LoggerTest, MappedFileLoggerCrashTest)
+{
+    ScratchDir        dir("au_mapped_crash_test");
+    const std::string filename = dir.file("flight.log");
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        // Leaked on purpose, the process dies without unmapping or flushing
+        auto* logger = new MappedFileLogger(filename, 1 << 16);
+        logger->write(Message("Last words"));
+        std::abort();
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFSIGNALED(status));
+    EXPECT_NE(dumpMapped(filename).find("Last words"), std::string::npos);
+}
+#endif
+
 TEST(LoggerTest, GenericLoggerTest)
 {
     // We expect validateLoggerType to throw
@@ -342,6 +567,33 @@ TEST(LoggerTest, GenericLoggerTest)
     EXPECT_EQ(logger1.getLoggerName(), "TestLogger");
 }
 
+// Implements ILogger directly, as applications written against the
+// original interface do
+class PlainLogger : public ILogger
+{
+  public:
+    std::vector<std::string> m_lines{};
+    std::string              m_name{};
+
+    void write(const Message& msg) override
+    {
+        m_lines.push_back(msg.getText());
+    }
+    void        flush() override {}
+    void        setLoggerName(const String& name) override { m_name = name; }
+    std::string getLoggerName() const override { return m_name; }
+    std::string getLoggerType() const override { return "PlainLogger"; }
+};
+
+TEST(LoggerTest, ILoggerDefaultsTest)
+{
+    PlainLogger logger;
+    logger.writeBatch({ Message("first"), Message("second") });
+    std::vector<std::string> expected{ "first", "second" };
+    EXPECT_EQ(logger.m_lines, expected);
+    EXPECT_EQ(logger.getBytesWritten(), 0u);
+}
+
 TEST(LoggerTest, ConsoleLoggerTest)
 {
     auto consoleLogger =
@@ -382,6 +634,892 @@ TEST(LoggerTest, DummyLoggerTest)
     EXPECT_TRUE(output.empty());
 }
 
+// Counts writes and flushes, safe to inspect from the test thread
+class CountingLogger : public GenericLogger
+{
+  public:
+    std::atomic<int>& m_writes;
+    std::atomic<int>& m_flushes;
+
+    CountingLogger(std::atomic<int>& writes, std::atomic<int>& flushes)
+        : GenericLogger()
+        , m_writes{ writes }
+        , m_flushes{ flushes }
+    {
+    }
+    void        write(const Message& msg) override { m_writes++; }
+    void        flush() override { m_flushes++; }
+    std::string getLoggerType() const override { return "CountingLogger"; }
+};
+
+TEST(LoggerTest, DrainTest)
+{
+    std::atomic<int> writes{ 0 }, flushes{ 0 };
+    LogWriter::setLogger(std::make_unique<CountingLogger>(writes, flushes));
+    auto logWriter = LogWriter::getLogWriter();
+
+    // Nothing queued, must return right away
+    logWriter->drain();
+    EXPECT_EQ(writes, 0);
+
+    std::vector<Message> msgs;
+    for (int i = 0; i < 100; i++) {
+        msgs.emplace_back("This is a message " + std::to_string(i));
+    }
+    logWriter->log(msgs);
+    logWriter->drain();
+    EXPECT_EQ(writes, 100);
+    EXPECT_EQ(flushes, 0);
+
+    logWriter->stop();
+    EXPECT_EQ(flushes, 1);
+}
+
+TEST(LoggerTest, WakeupAfterParkTest)
+{
+    std::atomic<int> writes{ 0 }, flushes{ 0 };
+    LogWriter::setLogger(std::make_unique<CountingLogger>(writes, flushes));
+    auto logWriter = LogWriter::getLogWriter();
+
+    for (auto mode : { WakeupMode::eSpinThenPark, WakeupMode::eBusySpin }) {
+        logWriter->setWakeupMode(mode);
+        std::vector<Message> msgs;
+        msgs.emplace_back("Before park");
+        logWriter->log(msgs);
+        logWriter->drain();
+
+        // Give the thread time to leave the spin phase and park
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        msgs.clear();
+        msgs.emplace_back("After park");
+        logWriter->log(msgs);
+        logWriter->drain();
+    }
+    EXPECT_EQ(writes, 4);
+
+    logWriter->stop();
+}
+
+TEST(LoggerTest, FlushIntervalTest)
+{
+    std::atomic<int> writes{ 0 }, flushes{ 0 };
+    LogWriter::setLogger(std::make_unique<CountingLogger>(writes, flushes));
+    auto logWriter = LogWriter::getLogWriter();
+    logWriter->setFlushInterval(std::chrono::milliseconds(10));
+
+    std::vector<Message> msgs;
+    msgs.emplace_back("This message gets flushed");
+    logWriter->log(msgs);
+
+    // Flushed by the logging thread, well before stop()
+    for (int i = 0; i < 200 && flushes == 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_GE(flushes, 1);
+    EXPECT_EQ(writes, 1);
+
+    logWriter->stop();
+}
+
+TEST(LoggerTest, PersistentWriterTest)
+{
+    std::atomic<int> writes{ 0 }, flushes{ 0 };
+    LogWriter::setLogger(std::make_unique<CountingLogger>(writes, flushes));
+    auto logWriter = LogWriter::getLogWriter();
+
+    // The macros keep using the same writer and thread
+    for (int i = 0; i < 10; i++) {
+        AU_LOGGER_LOG_INFO("Message from the macro " + std::to_string(i));
+        EXPECT_EQ(LogWriter::getLogWriter(), logWriter);
+    }
+    logWriter->flush();
+    EXPECT_EQ(writes, 10);
+    EXPECT_EQ(flushes, 1);
+
+    // Nothing written since, still served
+    logWriter->flush();
+    EXPECT_EQ(flushes, 2);
+
+    // Pending messages go to the logger being replaced
+    std::atomic<int> newWrites{ 0 }, newFlushes{ 0 };
+    AU_LOGGER_LOG_INFO("Written to the first logger");
+    LogWriter::setLogger(
+        std::make_unique<CountingLogger>(newWrites, newFlushes));
+    EXPECT_EQ(writes, 11);
+    AU_LOGGER_LOG_INFO("Written to the second logger");
+
+    LogWriter::shutdown();
+    EXPECT_EQ(newWrites, 1);
+    EXPECT_EQ(newFlushes, 1);
+    EXPECT_NE(LogWriter::getLogWriter(), logWriter);
+    LogWriter::shutdown();
+}
+
+// Records the size of every batch handed to the logger
+class BatchRecordingLogger : public GenericLogger
+{
+  public:
+    std::vector<size_t>& m_batches;
+
+    explicit BatchRecordingLogger(std::vector<size_t>& batches)
+        : GenericLogger()
+        , m_batches{ batches }
+    {
+    }
+    void write(const Message& msg) override { m_batches.push_back(1); }
+    void writeBatch(const std::vector<Message>& msgs) override
+    {
+        m_batches.push_back(msgs.size());
+    }
+    void        flush() override {}
+    std::string getLoggerType() const override { return "BatchLogger"; }
+};
+
+TEST(LoggerTest, BatchSizeTest)
+{
+    std::vector<size_t> batches;
+    LogWriter::setLogger(std::make_unique<BatchRecordingLogger>(batches));
+    auto logWriter = LogWriter::getLogWriter();
+    logWriter->setBatchSize(8);
+
+    std::vector<Message> msgs;
+    for (int i = 0; i < 100; i++) {
+        msgs.emplace_back("This is a message " + std::to_string(i));
+    }
+    logWriter->log(msgs);
+    logWriter->drain();
+
+    size_t total = 0;
+    for (auto size : batches) {
+        EXPECT_GE(size, 1u);
+        EXPECT_LE(size, 8u);
+        total += size;
+    }
+    EXPECT_EQ(total, 100u);
+    EXPECT_GE(batches.size(), 13u);
+
+    logWriter->stop();
+}
+
+TEST(LoggerTest, MaxBatchDelayTest)
+{
+    std::vector<size_t> batches;
+    LogWriter::setLogger(std::make_unique<BatchRecordingLogger>(batches));
+    auto logWriter = LogWriter::getLogWriter();
+    logWriter->setMaxBatchDelay(std::chrono::milliseconds(100));
+
+    // Two trickled messages end up in one batch
+    std::vector<Message> msgs;
+    msgs.emplace_back("First message");
+    logWriter->log(msgs);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    msgs.clear();
+    msgs.emplace_back("Second message");
+    logWriter->log(msgs);
+    logWriter->drain();
+
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(batches[0], 2u);
+
+    logWriter->stop();
+}
+
+TEST(LoggerTest, FileLoggerBatchTest)
+{
+    const std::string testFilename = "test_file_logger_batch.log";
+    std::remove(testFilename.c_str());
+    {
+        LogWriter::setLogger(
+            LoggerFactory::createLogger("FileLogger", testFilename));
+        auto logWriter = LogWriter::getLogWriter();
+        logWriter->setBatchSize(64);
+
+        std::vector<Message> msgs;
+        for (int i = 0; i < 500; i++) {
+            msgs.emplace_back("Batched line " + std::to_string(i));
+        }
+        logWriter->log(msgs);
+        logWriter->stop();
+    }
+
+    std::ifstream infile(testFilename);
+    ASSERT_TRUE(infile.good()) << "Log file not created";
+    std::string line;
+    int         count = 0;
+    while (std::getline(infile, line)) {
+        EXPECT_NE(line.find("Batched line " + std::to_string(count)),
+                  std::string::npos);
+        count++;
+    }
+    infile.close();
+    EXPECT_EQ(count, 500);
+
+    std::remove(testFilename.c_str());
+}
+
+// Counts the messages of every level it is given
+class LevelCountingLogger : public GenericLogger
+{
+  public:
+    std::map<Uint32, int>& m_counts;
+    std::mutex&            m_mutex;
+
+    LevelCountingLogger(std::map<Uint32, int>& counts, std::mutex& mutex)
+        : GenericLogger()
+        , m_counts{ counts }
+        , m_mutex{ mutex }
+    {
+    }
+    void write(const Message& msg) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_counts[static_cast<Uint32>(msg.getPriority().getLevel())]++;
+    }
+    void        flush() override {}
+    std::string getLoggerType() const override { return "LevelLogger"; }
+};
+
+// Blocks in write() until released
+class StalledLogger : public GenericLogger
+{
+  public:
+    std::shared_future<void> m_release;
+    std::atomic<int>&        m_writes;
+
+    StalledLogger(std::shared_future<void> release, std::atomic<int>& writes)
+        : GenericLogger()
+        , m_release{ std::move(release) }
+        , m_writes{ writes }
+    {
+    }
+    void write(const Message& msg) override
+    {
+        m_release.wait();
+        m_writes++;
+    }
+    void        flush() override {}
+    std::string getLoggerType() const override { return "StalledLogger"; }
+};
+
+TEST(LoggerTest, FanOutLevelMaskTest)
+{
+    using Level = Priority::PriorityLevel;
+    std::map<Uint32, int> warn, debug, trace;
+    std::mutex            mutex;
+
+    auto sinks = std::make_unique<FanOutLogger>();
+    sinks->addSink(std::make_unique<LevelCountingLogger>(warn, mutex),
+                   levelMaskUpTo(Level::eWarning));
+    size_t debugSink =
+        sinks->addSink(std::make_unique<LevelCountingLogger>(debug, mutex),
+                       levelMaskUpTo(Level::eDebug));
+    sinks->addSink(std::make_unique<LevelCountingLogger>(trace, mutex),
+                   levelMaskUpTo(Level::eTrace));
+    EXPECT_EQ(sinks->getSinkCount(), 3u);
+    EXPECT_EQ(sinks->getDroppedCount(debugSink), 0u);
+    LogWriter::setLogger(std::move(sinks));
+    auto logWriter = LogWriter::getLogWriter();
+
+    std::vector<Message> msgs;
+    for (Level level : { Level::eError, Level::eWarning, Level::eInfo,
+                         Level::eDebug, Level::eTrace }) {
+        Priority priority(level);
+        for (int i = 0; i < 10; i++) {
+            msgs.emplace_back("Fan out " + std::to_string(i), priority);
+        }
+    }
+    logWriter->log(msgs);
+    logWriter->flush();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(warn.size(), 2u);
+    EXPECT_EQ(warn[static_cast<Uint32>(Level::eWarning)], 10);
+    EXPECT_EQ(debug.size(), 4u);
+    EXPECT_EQ(debug.count(static_cast<Uint32>(Level::eTrace)), 0u);
+    EXPECT_EQ(trace.size(), 5u);
+    EXPECT_EQ(trace[static_cast<Uint32>(Level::eTrace)], 10);
+}
+
+TEST(LoggerTest, FanOutSlowSinkTest)
+{
+    std::promise<void> release;
+    std::atomic<int>   stalledWrites{ 0 }, fastWrites{ 0 }, flushes{ 0 };
+
+    auto sinks = std::make_unique<FanOutLogger>();
+    sinks->addSink(
+        std::make_unique<StalledLogger>(release.get_future().share(),
+                                        stalledWrites),
+        levelMaskUpTo(Priority::PriorityLevel::eTrace));
+    sinks->addSink(std::make_unique<CountingLogger>(fastWrites, flushes),
+                   levelMaskUpTo(Priority::PriorityLevel::eTrace));
+    LogWriter::setLogger(std::move(sinks));
+    auto logWriter = LogWriter::getLogWriter();
+
+    std::vector<Message> msgs;
+    for (int i = 0; i < 100; i++) {
+        msgs.emplace_back("This is a message " + std::to_string(i));
+    }
+    logWriter->log(msgs);
+
+    // The fast sink keeps going while the other one is stuck
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (fastWrites < 100 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(fastWrites, 100);
+    EXPECT_EQ(stalledWrites, 0);
+
+    release.set_value();
+    logWriter->flush();
+    EXPECT_EQ(stalledWrites, 100);
+    EXPECT_GE(flushes, 1);
+}
+
+// Keeps the text of every message written
+class TextRecordingLogger : public GenericLogger
+{
+  public:
+    std::vector<std::string>& m_lines;
+    std::mutex&               m_mutex;
+
+    TextRecordingLogger(std::vector<std::string>& lines, std::mutex& mutex)
+        : GenericLogger()
+        , m_lines{ lines }
+        , m_mutex{ mutex }
+    {
+    }
+    void write(const Message& msg) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_lines.push_back(msg.getMsg());
+    }
+    void        flush() override {}
+    std::string getLoggerType() const override { return "TextLogger"; }
+};
+
+TEST(LoggerTest, FanOutWriteTest)
+{
+    std::vector<std::string> first, second, warnings;
+    std::mutex               mutex;
+
+    FanOutLogger sinks;
+    sinks.addSink(std::make_unique<TextRecordingLogger>(first, mutex),
+                  levelMaskUpTo(Priority::PriorityLevel::eTrace));
+    sinks.addSink(std::make_unique<TextRecordingLogger>(warnings, mutex),
+                  levelMaskUpTo(Priority::PriorityLevel::eWarning));
+    sinks.addSink(std::make_unique<TextRecordingLogger>(second, mutex),
+                  levelMaskUpTo(Priority::PriorityLevel::eTrace));
+
+    const Message copied("Copied message",
+                         Priority(Priority::PriorityLevel::eInfo));
+    sinks.write(copied);
+    sinks.write(
+        Message("Moved message", Priority(Priority::PriorityLevel::eInfo)));
+    sinks.flush();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto* lines : { &first, &second }) {
+        ASSERT_EQ(lines->size(), 2u);
+        EXPECT_NE((*lines)[0].find("Copied message"), std::string::npos);
+        EXPECT_NE((*lines)[1].find("Moved message"), std::string::npos);
+    }
+    EXPECT_TRUE(warnings.empty());
+}
+
+TEST(LoggerTest, FanOutConsumeBatchTest)
+{
+    std::vector<std::string> all, warnings;
+    std::mutex               mutex;
+
+    FanOutLogger sinks;
+    sinks.addSink(std::make_unique<TextRecordingLogger>(all, mutex),
+                  levelMaskUpTo(Priority::PriorityLevel::eTrace));
+    sinks.addSink(std::make_unique<TextRecordingLogger>(warnings, mutex),
+                  levelMaskUpTo(Priority::PriorityLevel::eWarning));
+
+    // The info message is moved into the first sink, the error one copied
+    // there and moved into the second
+    std::vector<Message> batch;
+    batch.emplace_back("Info message",
+                       Priority(Priority::PriorityLevel::eInfo));
+    batch.emplace_back("Error message",
+                       Priority(Priority::PriorityLevel::eError));
+    sinks.consumeBatch(batch);
+    sinks.flush();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(all.size(), 2u);
+    EXPECT_NE(all[0].find("Info message"), std::string::npos);
+    EXPECT_NE(all[1].find("Error message"), std::string::npos);
+    ASSERT_EQ(warnings.size(), 1u);
+    EXPECT_NE(warnings[0].find("Error message"), std::string::npos);
+}
+
+TEST(LoggerTest, RateLimitTest)
+{
+    std::vector<std::string> lines;
+    std::mutex               mutex;
+    LogWriter::setLogger(std::make_unique<TextRecordingLogger>(lines, mutex));
+    auto logWriter = LogWriter::getLogWriter();
+
+    // One call site, mostly within the same second
+    auto logMany = [](int count) {
+        for (int i = 0; i < count; i++) {
+            AU_LOGGER_LOG_RATE("Limited message", eInfo, 5);
+        }
+    };
+    logMany(1000);
+    logWriter->flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // A second boundary in the loop lets another 5 through
+        EXPECT_GE(lines.size(), 5u);
+        EXPECT_LE(lines.size(), 10u);
+        lines.clear();
+    }
+
+    // The first call of the next second reports the dropped ones
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    logMany(1);
+    logWriter->flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ASSERT_EQ(lines.size(), 1u);
+        EXPECT_NE(lines[0].find("suppressed="), std::string::npos);
+        lines.clear();
+    }
+
+    // The global limit applies to the plain macros, 0 lifts it
+    LogWriter::setRateLimit(3);
+    for (int i = 0; i < 100; i++) {
+        AU_LOGGER_LOG_INFO("Globally limited");
+    }
+    LogWriter::setRateLimit(0);
+    for (int i = 0; i < 100; i++) {
+        AU_LOGGER_LOG_INFO("Not limited");
+    }
+    logWriter->flush();
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_LE(lines.size(), 106u);
+    EXPECT_GE(lines.size(), 103u);
+}
+
+TEST(LoggerTest, CoalesceRepeatsTest)
+{
+    std::vector<std::string> lines;
+    std::mutex               mutex;
+    LogWriter::setLogger(std::make_unique<TextRecordingLogger>(lines, mutex));
+    auto logWriter = LogWriter::getLogWriter();
+    logWriter->setCoalesceRepeats(true);
+
+    std::vector<Message> msgs;
+    msgs.emplace_back("Disk is full");
+    for (int i = 0; i < 50; i++) {
+        msgs.emplace_back("Retrying");
+    }
+    msgs.emplace_back("Giving up");
+    msgs.emplace_back("Giving up");
+    logWriter->log(msgs);
+    logWriter->flush();
+    logWriter->setCoalesceRepeats(false);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& line : lines) {
+        line.erase(0, line.rfind(" : ") + 3); // Timestamp and priority
+    }
+    std::vector<std::string> expected{ "Disk is full",
+                                       "Retrying",
+                                       "Last message repeated 49 times",
+                                       "Giving up",
+                                       "Last message repeated 1 times" };
+    EXPECT_EQ(lines, expected);
+}
+
+TEST(LoggerTest, LegacyLoggerTest)
+{
+    std::vector<std::string> lines;
+    std::mutex               mutex;
+    LogWriter::setLogger(std::make_unique<TextRecordingLogger>(lines, mutex));
+    auto logWriter = LogWriter::getLogWriter();
+
+    auto& legacy = Au::Logger::getInstance();
+    legacy.setLevel(Au::LogLevel::INFO);
+    legacy.log(Au::LogLevel::DEBUG, "Filtered");
+    legacy.log(Au::LogLevel::INFO, "Value is:", std::hex, 255);
+    // Formatting of the previous call does not carry over
+    legacy.log(Au::LogLevel::CRITICAL, "Count", 10, "of", 12);
+    legacy.setLevel(Au::LogLevel::CRITICAL);
+    logWriter->flush();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_NE(lines[0].find("Info"), std::string::npos);
+    // The manipulator takes a separator of its own, as it always did
+    EXPECT_NE(lines[0].find("Value is:  ff"), std::string::npos);
+    EXPECT_NE(lines[1].find("Panic"), std::string::npos);
+    EXPECT_NE(lines[1].find("Count 10 of 12"), std::string::npos);
+}
+
+TEST(LoggerTest, LegacyLoggerFileTest)
+{
+    std::vector<std::string> lines;
+    std::mutex               mutex;
+    LogWriter::setLogger(std::make_unique<TextRecordingLogger>(lines, mutex));
+    auto logWriter = LogWriter::getLogWriter();
+
+    auto& legacy = Au::Logger::getInstance();
+    legacy.setLevel(Au::LogLevel::INFO, true);
+    legacy.log(Au::LogLevel::INFO, "Legacy message");
+    AU_LOGGER_LOG_INFO("Application message");
+    // Turning the file off writes it out
+    legacy.setLevel(Au::LogLevel::CRITICAL);
+    logWriter->flush();
+
+    // The logger of the application saw both messages
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ASSERT_EQ(lines.size(), 2u);
+        EXPECT_NE(lines[0].find("Legacy message"), std::string::npos);
+        EXPECT_NE(lines[1].find("Application message"), std::string::npos);
+    }
+    // The legacy file only the legacy one
+    std::string file = readFile("cpuidlog.txt");
+    std::remove("cpuidlog.txt");
+    EXPECT_NE(file.find("Legacy message"), std::string::npos);
+    EXPECT_EQ(file.find("Application message"), std::string::npos);
+}
+
+TEST(LoggerTest, StatsTest)
+{
+    ScratchDir        dir("au_logger_stats");
+    const std::string filename = dir.file("stats.log");
+    LogWriter::setLogger(std::make_unique<FileLogger>(filename));
+    auto logWriter = LogWriter::getLogWriter();
+
+    LogWriterStats before = LogWriter::getStats();
+    for (int i = 0; i < 200; i++) {
+        AU_LOGGER_LOG_INFO("Counted message " + std::to_string(i));
+    }
+    logWriter->flush();
+    LogWriterStats after = LogWriter::getStats();
+
+    EXPECT_EQ(after.messagesWritten - before.messagesWritten, 200u);
+    EXPECT_EQ(after.bytesWritten - before.bytesWritten,
+              readFile(filename).size());
+    EXPECT_EQ(after.messagesDropped, before.messagesDropped);
+    EXPECT_GE(after.maxQueueDepth, 1u);
+    // Idle after the flush, nothing is queued
+    EXPECT_EQ(after.queueDepth, 0u);
+    // One in 64 calls of a thread is timed
+    EXPECT_GE(after.enqueueSamples - before.enqueueSamples, 3u);
+    EXPECT_GE(after.enqueueLatencyMaxNs, after.enqueueLatencyAvgNs);
+    EXPECT_GT(after.writerBusyNs, before.writerBusyNs);
+    EXPECT_LE(after.writerBusyNs, after.writerRunNs);
+    EXPECT_GT(after.writerUtilization, 0.0);
+    EXPECT_LE(after.writerUtilization, 1.0);
+
+    // A full queue shows up as drops
+    LogWriter::setQueue(
+        std::make_unique<RingQueue>(16, OverflowPolicy::eDropNewest));
+    std::vector<Message> msgs;
+    for (int i = 0; i < 1000; i++) {
+        msgs.emplace_back("Dropped message");
+    }
+    logWriter = LogWriter::getLogWriter();
+    logWriter->log(msgs);
+    logWriter->flush();
+    LogWriterStats dropped = LogWriter::getStats();
+    EXPECT_EQ(dropped.messagesDropped - after.messagesDropped,
+              logWriter->getDroppedCount());
+    EXPECT_EQ(dropped.messagesWritten - after.messagesWritten
+                  + dropped.messagesDropped - after.messagesDropped,
+              1000u);
+
+    // Same counters through the C API
+    au_logger_stats_t cstats;
+    au_logger_get_stats(&cstats);
+    EXPECT_GE(cstats.messages_written, dropped.messagesWritten);
+    EXPECT_EQ(cstats.messages_dropped, dropped.messagesDropped);
+    LogWriter::setQueue(std::make_unique<PerThreadQueue>());
+    LogWriter::shutdown();
+}
+
+TEST(LoggerTest, CapiLogfTest)
+{
+    std::vector<std::string> lines;
+    std::mutex               mutex;
+    LogWriter::setLogger(std::make_unique<TextRecordingLogger>(lines, mutex));
+
+    logger_ctx_t* first  = au_logger_create();
+    logger_ctx_t* second = au_logger_create();
+    int           value  = 42;
+    au_logger_logf(first,
+                   AUD_LOG_LEVEL_INFO,
+                   "int %d long %ld size %zu str %s dbl %.2f char %c hex %#x",
+                   -7,
+                   123456789012L,
+                   size_t(99),
+                   "text",
+                   2.5,
+                   'z',
+                   255u);
+    au_logger_logf(first, AUD_LOG_LEVEL_WARN, "ptr %p", (void*)&value);
+
+    // Other contexts keep working after one is destroyed
+    au_logger_destroy(first);
+    au_logger_log(second, "plain", AUD_LOG_LEVEL_ERROR);
+
+    // A reused buffer with new text gets its own format
+    char format[32];
+    std::strcpy(format, "first %d");
+    au_logger_logf(second, AUD_LOG_LEVEL_INFO, format, 1);
+    Uint32 formats = Au::Logger::FormatRegistry::get().getCount();
+    std::strcpy(format, "second %d");
+    au_logger_logf(second, AUD_LOG_LEVEL_INFO, format, 2);
+    std::strcpy(format, "first %d");
+    au_logger_logf(second, AUD_LOG_LEVEL_INFO, format, 3);
+    EXPECT_EQ(Au::Logger::FormatRegistry::get().getCount(), formats + 1);
+
+    // Filtered before the arguments are read
+    LogWriter::setLevel(Priority::PriorityLevel::eWarning);
+    au_logger_logf(second, AUD_LOG_LEVEL_DEBUG, "filtered %s", "out");
+    LogWriter::setLevel(Priority::PriorityLevel::eTrace);
+    au_logger_flush(second);
+    au_logger_destroy(second);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& line : lines) {
+        line.erase(0, line.rfind(" : ") + 3); // Timestamp and priority
+    }
+    char pointer[32];
+    std::snprintf(pointer, sizeof(pointer), "ptr %p", (void*)&value);
+    std::vector<std::string> expected{
+        "int -7 long 123456789012 size 99 str text dbl 2.50 char z hex 0xff",
+        pointer,
+        "plain",
+        "first 1",
+        "second 2",
+        "first 3"
+    };
+    EXPECT_EQ(lines, expected);
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+// Records the affinity of the thread writing each message
+class AffinityRecordingLogger : public GenericLogger
+{
+  public:
+    std::vector<int>& m_cpus;
+
+    explicit AffinityRecordingLogger(std::vector<int>& cpus)
+        : GenericLogger()
+        , m_cpus{ cpus }
+    {
+    }
+    void write(const Message& msg) override
+    {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        pthread_getaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+        int cpu = -1;
+        if (CPU_COUNT(&cpuset) == 1) {
+            while (!CPU_ISSET(++cpu, &cpuset)) {
+            }
+        }
+        m_cpus.push_back(cpu);
+    }
+    void        flush() override {}
+    std::string getLoggerType() const override { return "AffinityLogger"; }
+};
+
+TEST(LoggerTest, CapiShutdownTest)
+{
+    std::vector<std::string> lines;
+    std::mutex               mutex;
+    LogWriter::setLogger(std::make_unique<TextRecordingLogger>(lines, mutex));
+    logger_ctx_t* logger = au_logger_create();
+    au_logger_log(logger, "before", AUD_LOG_LEVEL_INFO);
+    LogWriter::shutdown();
+
+    // The context logs through the next writer; more messages than a
+    // per-thread buffer holds, nothing may be left undrained
+    LogWriter::setLogger(std::make_unique<TextRecordingLogger>(lines, mutex));
+    for (int i = 0; i < 5000; i++) {
+        au_logger_logf(logger, AUD_LOG_LEVEL_INFO, "after %d", i);
+    }
+    au_logger_flush(logger);
+    au_logger_destroy(logger);
+    LogWriter::shutdown();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(lines.size(), 5001u);
+    EXPECT_NE(lines.front().find("before"), std::string::npos);
+    EXPECT_NE(lines.back().find("after 4999"), std::string::npos);
+}
+
+TEST(LoggerTest, CapiRuntimeFormatTest)
+{
+    std::vector<std::string> lines;
+    std::mutex               mutex;
+    LogWriter::setLogger(std::make_unique<TextRecordingLogger>(lines, mutex));
+    FormatRegistry& registry = FormatRegistry::get();
+    const size_t    count    = FormatRegistry::cMaxInterned + 16;
+    const Uint32    before   = registry.getCount();
+
+    // Formats built at run time stop being registered at the limit
+    logger_ctx_t* logger = au_logger_create();
+    for (size_t i = 0; i < count; i++) {
+        std::string format = "format " + std::to_string(i) + " value %d";
+        au_logger_logf(logger, AUD_LOG_LEVEL_INFO, format.c_str(), 7);
+    }
+    au_logger_flush(logger);
+    au_logger_destroy(logger);
+    EXPECT_LE(registry.getCount() - before, FormatRegistry::cMaxInterned);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(lines.size(), count);
+    EXPECT_NE(lines.front().find("format 0 value 7"), std::string::npos);
+    EXPECT_NE(lines.back().find("format " + std::to_string(count - 1)
+                                + " value 7"),
+              std::string::npos);
+}
+
+TEST(LoggerTest, WriterPlacementTest)
+{
+    std::vector<int> cpus;
+    LogWriter::setLogger(std::make_unique<AffinityRecordingLogger>(cpus));
+    auto logWriter = LogWriter::getLogWriter();
+    int  count     = static_cast<int>(std::thread::hardware_concurrency());
+
+    EXPECT_EQ(logWriter->setPlacement(WriterPlacement::eCpu, count), -1);
+    EXPECT_EQ(logWriter->setPlacement(WriterPlacement::eFloating), -1);
+    int sibling = logWriter->setPlacement(WriterPlacement::eLastSibling);
+    EXPECT_GE(sibling, 0);
+    EXPECT_LT(sibling, count);
+    int near = logWriter->setPlacement(WriterPlacement::eNearProducer);
+    EXPECT_GE(near, 0);
+    EXPECT_LT(near, count);
+
+    int target = count - 1;
+    EXPECT_EQ(logWriter->setPlacement(WriterPlacement::eCpu, target), target);
+    std::vector<Message> msgs;
+    msgs.emplace_back("Pinned");
+    logWriter->log(msgs);
+    logWriter->flush();
+    EXPECT_EQ(logWriter->getPlacementCpu(), target);
+    ASSERT_EQ(cpus.size(), 1u);
+    EXPECT_EQ(cpus[0], target);
+
+    // Kept when the thread is restarted
+    LogWriter::setLogger(std::make_unique<AffinityRecordingLogger>(cpus));
+    msgs.clear();
+    msgs.emplace_back("Restarted");
+    logWriter->log(msgs);
+    logWriter->flush();
+    ASSERT_EQ(cpus.size(), 2u);
+    EXPECT_EQ(cpus[1], target);
+    logWriter->setPlacement(WriterPlacement::eFloating);
+
+    // Initial placement of a new writer
+    LogWriter::shutdown();
+    Au::Env::set("AU_LOGGER_WRITER_CPU", std::to_string(target));
+    EXPECT_EQ(LogWriter::getLogWriter()->getPlacementCpu(), target);
+    LogWriter::shutdown();
+    Au::Env::set("AU_LOGGER_WRITER_CPU", "last-sibling");
+    EXPECT_EQ(LogWriter::getLogWriter()->getPlacementCpu(), sibling);
+    LogWriter::shutdown();
+    Au::Env::set("AU_LOGGER_WRITER_CPU", "somewhere");
+    EXPECT_EQ(LogWriter::getLogWriter()->getPlacementCpu(), -1);
+    Au::Env::unset("AU_LOGGER_WRITER_CPU");
+    LogWriter::shutdown();
+}
+
+// Takes one message and never returns, keeps the rest queued
+class StuckLogger : public GenericLogger
+{
+  public:
+    std::atomic<bool>& m_stuck;
+
+    explicit StuckLogger(std::atomic<bool>& stuck)
+        : GenericLogger()
+        , m_stuck{ stuck }
+    {
+    }
+    void write(const Message& msg) override
+    {
+        m_stuck = true;
+        for (;;) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+    }
+    void        flush() override {}
+    std::string getLoggerType() const override { return "StuckLogger"; }
+};
+
+TEST(LoggerTest, CrashFlushTest)
+{
+    ScratchDir        dir("au_crash_flush_test");
+    const std::string filename = dir.file("crash.log");
+    Uint32 formatId = FormatRegistry::get().registerFormat(
+        "value %d pi %.2f str %s ptr %p");
+
+    // The child starts its own logging thread
+    LogWriter::shutdown();
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        LogWriter::setCrashFlush(true, fd);
+        std::atomic<bool> stuck{ false };
+        LogWriter::setLogger(std::make_unique<StuckLogger>(stuck));
+        auto logWriter = LogWriter::getLogWriter();
+
+        std::vector<Message> msgs;
+        msgs.emplace_back("Taken by the writer");
+        logWriter->log(msgs);
+        while (!stuck) {
+            std::this_thread::yield();
+        }
+        msgs.clear();
+        msgs.emplace_back("Queued message",
+                          Priority(Priority::PriorityLevel::eError));
+        msgs.push_back(Message::deferred(
+            formatId,
+            Priority(Priority::PriorityLevel::eWarning),
+            42,
+            3.14159,
+            "abc",
+            reinterpret_cast<void*>(0x1000)));
+        msgs.back().addField("key", 7);
+        logWriter->log(msgs);
+
+        // Leaked on purpose, its messages are never flushed
+        auto* manager = new LogManager(logWriter);
+        *manager << Message("Not flushed yet");
+        std::abort();
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFSIGNALED(status));
+    EXPECT_EQ(WTERMSIG(status), SIGABRT);
+
+    std::ifstream     file(filename);
+    std::stringstream text;
+    text << file.rdbuf();
+    std::string dump = text.str();
+    EXPECT_NE(dump.find("Log messages pending at signal 6:\n"),
+              std::string::npos);
+    EXPECT_NE(dump.find(" : Error   : Queued message\n"), std::string::npos);
+    EXPECT_NE(dump.find(" : Warning : value 42 pi 3.141590 str abc ptr "
+                        "0x1000 key=7\n"),
+              std::string::npos);
+    EXPECT_NE(dump.find(" : Info    : Not flushed yet\n"), std::string::npos);
+    EXPECT_EQ(dump.find("Taken by the writer"), std::string::npos);
+    EXPECT_LT(dump.find("Queued message"), dump.find("value 42"));
+}
+#endif
+
 // Gtest main with an argument parser
 int
 main(int argc, char** argv)
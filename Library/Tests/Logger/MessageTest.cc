@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2025-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -27,9 +27,15 @@
  */
 
 #include "Au/Logger/Message.hh"
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 using namespace Au::Logger;
+using Au::Uint64;
 
 TEST(MessageTest, TimestampCoverage)
 {
@@ -57,6 +63,57 @@ TEST(MessageTest, TimestampCoverage)
     EXPECT_GE(ns, us);
 }
 
+TEST(MessageTest, TimestampConversion)
+{
+    using namespace std::chrono;
+
+    // Captured on the steady clock, reported as wall clock time
+    Uint64 before =
+        duration_cast<nanoseconds>(system_clock::now().time_since_epoch())
+            .count();
+    Timestamp ts;
+    Uint64    after =
+        duration_cast<nanoseconds>(system_clock::now().time_since_epoch())
+            .count();
+    EXPECT_GE(ts.getNanosecond() + 1000000, before);
+    EXPECT_LE(ts.getNanosecond(), after + 1000000);
+
+    Timestamp later;
+    EXPECT_GE(later.getTicks(), ts.getTicks());
+
+    // Wall clock values round trip and format like strftime
+    const std::time_t seconds = 1725276696; // Mon Sep 02 2024 11:31:36 UTC
+    for (Uint64 fraction : { 0ull, 999999999ull }) {
+        Uint64    ns = seconds * 1000000000ull + fraction;
+        Timestamp fixed(ns);
+        EXPECT_EQ(fixed.getNanosecond(), ns);
+        EXPECT_EQ(fixed.getMillisecond(), ns / 1000000);
+
+        std::tm time = {};
+#if defined(_WIN32) || defined(_WIN64)
+        localtime_s(&time, &seconds);
+#else
+        localtime_r(&seconds, &time);
+#endif
+        char expected[64];
+        std::strftime(
+            expected, sizeof(expected), "%a %b %d %Y %H:%M:%S", &time);
+        EXPECT_EQ(fixed.getTimestamp(), expected);
+        EXPECT_EQ(fixed.getHour(), static_cast<Uint64>(time.tm_hour));
+        EXPECT_EQ(fixed.getMinute(), static_cast<Uint64>(time.tm_min));
+        EXPECT_EQ(fixed.getSecond(), static_cast<Uint64>(time.tm_sec));
+
+        // Next second is not served from the cached text
+        Timestamp next(ns + 1000000000ull);
+        EXPECT_NE(next.getTimestamp(), fixed.getTimestamp());
+    }
+
+    // Rebasing keeps timestamps on the wall clock
+    Timestamp::rebase();
+    EXPECT_GE(ts.getNanosecond() + 1000000, before);
+    EXPECT_LE(ts.getNanosecond(), after + 1000000);
+}
+
 TEST(MessageTest, PriorityCoverage)
 {
     // Default priority (Info)
@@ -140,4 +197,72 @@ TEST(MessageTest, MessageCoverage)
     Message  msg2("Priority message", p);
     EXPECT_TRUE(msg2.getMsg().find("Priority message") != std::string::npos);
     EXPECT_EQ(msg2.getPriority().toStr(), "Warning");
+
+    // Timestamp, priority padded to seven characters, text
+    Priority  info(Priority::PriorityLevel::eInfo);
+    Timestamp ts(1725276696000000000ull);
+    Message   msg3("Formatted message", info, ts);
+    EXPECT_EQ(msg3.getMsg(),
+              ts.getTimestamp() + " : Info    : Formatted message");
+    String appended = "> ";
+    msg3.appendMsg(appended);
+    EXPECT_EQ(appended, "> " + msg3.getMsg());
+}
+
+TEST(MessageTest, MessageBufferStorage)
+{
+    const std::string shortText(MessageBuffer::cInlineCapacity, 's');
+    const std::string longText(1000, 'l');
+
+    MessageBuffer shortBuf(shortText);
+    EXPECT_TRUE(shortBuf.isInline());
+    EXPECT_EQ(shortBuf.view(), shortText);
+
+    MessageBuffer longBuf(longText);
+    EXPECT_FALSE(longBuf.isInline());
+    EXPECT_EQ(longBuf.view(), longText);
+
+    // Moving takes over the block, copying gets a block of its own
+    const char*   block = longBuf.data();
+    MessageBuffer moved(std::move(longBuf));
+    EXPECT_EQ(moved.data(), block);
+    EXPECT_TRUE(longBuf.empty());
+    MessageBuffer copied(moved);
+    EXPECT_NE(copied.data(), block);
+    EXPECT_EQ(copied.view(), longText);
+
+    // Growing out of the inline storage keeps the bytes
+    shortBuf.push_back('!');
+    EXPECT_FALSE(shortBuf.isInline());
+    EXPECT_EQ(shortBuf.view(), shortText + "!");
+
+    // Larger than any slab block
+    MessageBuffer huge(std::string(SlabAllocator::cMaxBlockSize + 1, 'h'));
+    EXPECT_EQ(huge.size(), SlabAllocator::cMaxBlockSize + 1);
+    huge = std::move(copied);
+    EXPECT_EQ(huge.view(), longText);
+}
+
+TEST(MessageTest, SlabBlocksAcrossThreads)
+{
+    // Blocks allocated here and released by another thread are reused, the
+    // pool stops growing once it covers the working set
+    auto roundTrip = [] {
+        std::vector<Message> msgs;
+        for (int i = 0; i < 200; i++) {
+            msgs.emplace_back(std::string(300, 'a' + i % 26));
+        }
+        std::thread consumer([&msgs] {
+            std::vector<Message> taken(std::move(msgs));
+            EXPECT_EQ(taken.back().getPayload(), std::string(300, 'r'));
+        });
+        consumer.join();
+    };
+    roundTrip();
+    roundTrip();
+    Uint64 reserved = SlabAllocator::get().getReservedBytes();
+    for (int i = 0; i < 10; i++) {
+        roundTrip();
+    }
+    EXPECT_EQ(SlabAllocator::get().getReservedBytes(), reserved);
 }
@@ -0,0 +1,366 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <set>
+#include <thread>
+
+#include "Au/Logger/LogManager.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace Au::Logger;
+
+namespace {
+
+TEST(QueueTest, LockingQueueFifo)
+{
+    LockingQueue queue;
+    Message      msg("");
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryDequeue(msg));
+
+    for (int i = 0; i < 4; i++) {
+        queue.enqueue(Message("message " + std::to_string(i)));
+    }
+    EXPECT_EQ(queue.getCount(), 4u);
+
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.tryDequeue(msg));
+        EXPECT_NE(msg.getMsg().find("message " + std::to_string(i)),
+                  std::string::npos);
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.getDroppedCount(), 0u);
+}
+
+TEST(QueueTest, RingQueueCapacity)
+{
+    RingQueue queue(5);
+    EXPECT_EQ(queue.getCapacity(), 8u);
+    EXPECT_EQ(queue.getOverflowPolicy(), OverflowPolicy::eBlock);
+
+    RingQueue defaultQueue;
+    EXPECT_EQ(defaultQueue.getCapacity(), RingQueue::cDefaultCapacity);
+}
+
+TEST(QueueTest, RingQueueFifo)
+{
+    RingQueue queue(4);
+    Message   msg("");
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryDequeue(msg));
+    EXPECT_NE(queue.dequeue().getMsg().find("Empty Queue"), std::string::npos);
+
+    // Go around the ring a few times
+    for (int lap = 0; lap < 3; lap++) {
+        for (int i = 0; i < 4; i++) {
+            queue.enqueue(Message("message " + std::to_string(i)));
+        }
+        EXPECT_EQ(queue.getCount(), 4u);
+        for (int i = 0; i < 4; i++) {
+            ASSERT_TRUE(queue.tryDequeue(msg));
+            EXPECT_NE(msg.getMsg().find("message " + std::to_string(i)),
+                      std::string::npos);
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+    EXPECT_EQ(queue.getDroppedCount(), 0u);
+}
+
+TEST(QueueTest, RingQueueDropNewest)
+{
+    RingQueue queue(4, OverflowPolicy::eDropNewest);
+    Message   msg("");
+
+    for (int i = 0; i < 6; i++) {
+        queue.enqueue(Message("message " + std::to_string(i)));
+    }
+    EXPECT_EQ(queue.getCount(), 4u);
+    EXPECT_EQ(queue.getDroppedCount(), 2u);
+
+    // The first four survive
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.tryDequeue(msg));
+        EXPECT_NE(msg.getMsg().find("message " + std::to_string(i)),
+                  std::string::npos);
+    }
+    EXPECT_FALSE(queue.tryDequeue(msg));
+}
+
+TEST(QueueTest, RingQueueDropOldest)
+{
+    RingQueue queue(4, OverflowPolicy::eDropOldest);
+    Message   msg("");
+
+    for (int i = 0; i < 6; i++) {
+        queue.enqueue(Message("message " + std::to_string(i)));
+    }
+    EXPECT_EQ(queue.getCount(), 4u);
+    EXPECT_EQ(queue.getDroppedCount(), 2u);
+
+    // The last four survive
+    for (int i = 2; i < 6; i++) {
+        ASSERT_TRUE(queue.tryDequeue(msg));
+        EXPECT_NE(msg.getMsg().find("message " + std::to_string(i)),
+                  std::string::npos);
+    }
+    EXPECT_FALSE(queue.tryDequeue(msg));
+}
+
+TEST(QueueTest, RingQueueMultiProducer)
+{
+    constexpr int cProducers   = 8;
+    constexpr int cPerProducer = 2000;
+
+    // Small ring so producers block on the consumer regularly
+    RingQueue                queue(64, OverflowPolicy::eBlock);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < cProducers; p++) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < cPerProducer; i++) {
+                queue.enqueue(Message(std::to_string(p) + ":"
+                                      + std::to_string(i) + ";"));
+            }
+        });
+    }
+
+    std::set<std::string> seen;
+    std::vector<int>      lastIndex(cProducers, -1);
+    Message               msg("");
+    while (seen.size() < cProducers * cPerProducer) {
+        if (!queue.tryDequeue(msg)) {
+            continue;
+        }
+        // Payload is the tail of the formatted message
+        std::string text  = msg.getMsg();
+        auto        colon = text.rfind(':');
+        auto        start = text.rfind(' ', colon) + 1;
+        int         p     = std::stoi(text.substr(start, colon - start));
+        int         i     = std::stoi(text.substr(colon + 1));
+        // Messages from one producer keep their order
+        EXPECT_GT(i, lastIndex[p]);
+        lastIndex[p] = i;
+        seen.insert(text.substr(start));
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.getDroppedCount(), 0u);
+}
+
+TEST(QueueTest, PerThreadQueueFifo)
+{
+    PerThreadQueue queue(5, OverflowPolicy::eDropNewest);
+    Message        msg("");
+    EXPECT_EQ(queue.getCapacity(), 8u);
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryDequeue(msg));
+    EXPECT_NE(queue.dequeue().getMsg().find("Empty Queue"), std::string::npos);
+    EXPECT_EQ(queue.getBufferCount(), 0u);
+
+    // Go around the ring a few times, the last two overflow
+    for (int lap = 0; lap < 3; lap++) {
+        for (int i = 0; i < 10; i++) {
+            queue.enqueue(Message("message " + std::to_string(i)));
+        }
+        EXPECT_EQ(queue.getCount(), 8u);
+        for (int i = 0; i < 8; i++) {
+            ASSERT_TRUE(queue.tryDequeue(msg));
+            EXPECT_NE(msg.getMsg().find("message " + std::to_string(i)),
+                      std::string::npos);
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+    EXPECT_EQ(queue.getDroppedCount(), 6u);
+    EXPECT_EQ(queue.getBufferCount(), 1u);
+}
+
+TEST(QueueTest, PerThreadQueueMultiProducer)
+{
+    constexpr int cProducers   = 8;
+    constexpr int cPerProducer = 2000;
+
+    // Small buffers so producers block on the consumer regularly
+    PerThreadQueue           queue(64, OverflowPolicy::eBlock);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < cProducers; p++) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < cPerProducer; i++) {
+                queue.enqueue(Message(std::to_string(p) + ":"
+                                      + std::to_string(i) + ";"));
+            }
+        });
+    }
+
+    std::set<std::string> seen;
+    std::vector<int>      lastIndex(cProducers, -1);
+    Message               msg("");
+    while (seen.size() < cProducers * cPerProducer) {
+        if (!queue.tryDequeue(msg)) {
+            continue;
+        }
+        std::string text  = msg.getMsg();
+        auto        colon = text.rfind(':');
+        auto        start = text.rfind(' ', colon) + 1;
+        int         p     = std::stoi(text.substr(start, colon - start));
+        int         i     = std::stoi(text.substr(colon + 1));
+        // Messages from one producer keep their order
+        EXPECT_GT(i, lastIndex[p]);
+        lastIndex[p] = i;
+        seen.insert(text.substr(start));
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    // Buffers of the exited threads go away once the consumer sees them empty
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryDequeue(msg));
+    EXPECT_EQ(queue.getBufferCount(), 0u);
+    EXPECT_EQ(queue.getDroppedCount(), 0u);
+}
+
+TEST(QueueTest, PerThreadQueueRetire)
+{
+    PerThreadQueue queue;
+    Message        msg("");
+
+    // Messages of an exited thread are still delivered
+    std::thread([&queue]() {
+        queue.enqueue(Message("from a short lived thread"));
+    }).join();
+    EXPECT_EQ(queue.getBufferCount(), 1u);
+    EXPECT_EQ(queue.getCount(), 1u);
+    ASSERT_TRUE(queue.tryDequeue(msg));
+    EXPECT_NE(msg.getMsg().find("from a short lived thread"),
+              std::string::npos);
+    EXPECT_FALSE(queue.tryDequeue(msg));
+    EXPECT_EQ(queue.getBufferCount(), 0u);
+
+    // A thread outliving its queue registers with the next one
+    for (int i = 0; i < 3; i++) {
+        PerThreadQueue other;
+        other.enqueue(Message("message"));
+        EXPECT_EQ(other.getBufferCount(), 1u);
+    }
+}
+
+TEST(QueueTest, VisitPending)
+{
+    auto collect = [](const Message& msg, void* ctx) {
+        static_cast<std::vector<String>*>(ctx)->push_back(msg.getText());
+    };
+
+    std::vector<std::unique_ptr<IQueue>> queues;
+    queues.push_back(std::make_unique<LockingQueue>());
+    queues.push_back(std::make_unique<RingQueue>(4));
+    queues.push_back(std::make_unique<PerThreadQueue>(4));
+    for (auto& queue : queues) {
+        for (int i = 0; i < 3; i++) {
+            queue->enqueue(Message("message " + std::to_string(i)));
+        }
+        Message msg("");
+        ASSERT_TRUE(queue->tryDequeue(msg));
+
+        // Only what is still queued, nothing is removed
+        std::vector<String> texts;
+        queue->visitPending(collect, &texts);
+        EXPECT_EQ(texts, (std::vector<String>{ "message 1", "message 2" }));
+        EXPECT_EQ(queue->getCount(), 2u);
+    }
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Weffc++"
+class MockLogger : public GenericLogger
+{
+  public:
+    MOCK_METHOD(void, write, (const Message& msg), (override));
+    MOCK_METHOD(void, flush, (), (override));
+    std::string getLoggerType() const override { return "MockLogger"; }
+};
+#pragma GCC diagnostic pop
+
+TEST(QueueTest, LogWriterWithRingQueue)
+{
+    auto mockLogger = std::make_unique<MockLogger>();
+    EXPECT_CALL(*mockLogger, write(testing::_)).Times(16);
+    EXPECT_CALL(*mockLogger, flush()).Times(1);
+
+    LogWriter::setLogger(std::move(mockLogger));
+    LogWriter::setQueue(
+        std::make_unique<RingQueue>(1024, OverflowPolicy::eDropNewest));
+
+    auto logWriter = LogWriter::getLogWriter();
+
+    std::vector<Message> msgs;
+    for (int i = 0; i < 16; i++) {
+        msgs.emplace_back("This is a message " + std::to_string(i));
+    }
+    logWriter->log(msgs);
+    EXPECT_EQ(logWriter->getDroppedCount(), 0u);
+
+    logWriter->stop();
+}
+
+TEST(QueueTest, LogWriterFromManyThreads)
+{
+    auto mockLogger = std::make_unique<MockLogger>();
+    EXPECT_CALL(*mockLogger, write(testing::_)).Times(8 * 500);
+    EXPECT_CALL(*mockLogger, flush()).Times(1);
+
+    LogWriter::setLogger(std::move(mockLogger));
+    LogWriter::setQueue(std::make_unique<PerThreadQueue>(64));
+
+    auto                     logWriter = LogWriter::getLogWriter();
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 8; p++) {
+        producers.emplace_back([&logWriter]() {
+            LogManager logger(logWriter);
+            for (int i = 0; i < 500; i++) {
+                logger << Message("This is a message " + std::to_string(i));
+                if (i % 50 == 0) {
+                    logger.flush();
+                }
+            }
+        });
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    logWriter->stop();
+}
+
+} // namespace
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Au/Logger/Trace.hh"
+
+#include <gtest/gtest.h>
+
+using namespace Au::Logger;
+using Au::Uint32;
+
+namespace {
+
+// Starts every test with an empty trace and recording off
+class TraceTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Tracer::setEnabled(false);
+        Tracer::get().clear();
+    }
+    void TearDown() override { Tracer::setEnabled(false); }
+};
+
+void
+nestedSpans(int count)
+{
+    for (int i = 0; i < count; i++) {
+        AU_TRACE_SCOPE("outer");
+        {
+            AU_TRACE_SCOPE("inner");
+        }
+    }
+}
+
+size_t
+countOf(const std::string& text, const std::string& what)
+{
+    size_t count = 0;
+    for (size_t pos = text.find(what); pos != std::string::npos;
+         pos      = text.find(what, pos + what.size())) {
+        count++;
+    }
+    return count;
+}
+
+TEST_F(TraceTest, DisabledRecordsNothing)
+{
+    nestedSpans(10);
+    EXPECT_EQ(Tracer::get().getEventCount(), 0u);
+}
+
+TEST_F(TraceTest, NestedSpansPerThread)
+{
+    Tracer::setEnabled(true);
+    std::thread first(nestedSpans, 100);
+    std::thread second(nestedSpans, 50);
+    first.join();
+    second.join();
+    Tracer::setEnabled(false);
+
+    std::vector<TraceEvent> events;
+    std::vector<Uint32>     threads;
+    Tracer::get().getEvents(events, threads);
+    ASSERT_EQ(events.size(), 300u);
+    ASSERT_EQ(threads.size(), events.size());
+
+    // Spans of a thread are stored as they end, inner before outer
+    for (size_t i = 0; i < events.size(); i += 2) {
+        EXPECT_STREQ(events[i].name, "inner");
+        EXPECT_STREQ(events[i + 1].name, "outer");
+        EXPECT_EQ(threads[i], threads[i + 1]);
+        EXPECT_LE(events[i].begin, events[i].end);
+        EXPECT_LE(events[i + 1].begin, events[i].begin);
+        EXPECT_GE(events[i + 1].end, events[i].end);
+    }
+    EXPECT_NE(threads.front(), threads.back());
+    EXPECT_EQ(Tracer::get().getDroppedCount(), 0u);
+}
+
+TEST_F(TraceTest, ExitedThreadBuffers)
+{
+    Tracer& tracer = Tracer::get();
+    size_t  base   = tracer.getBufferCount();
+    auto    span   = [] { Tracer::record("span", 1, 2); };
+
+    // Spans of an exited thread are kept until exported
+    std::thread(span).join();
+    EXPECT_EQ(tracer.getBufferCount(), base + 1);
+    std::vector<TraceEvent> events;
+    std::vector<Uint32>     threads;
+    tracer.getEvents(events, threads);
+    ASSERT_EQ(events.size(), 1u);
+
+    // then the buffer goes to the next thread
+    for (int i = 0; i < 4; i++) {
+        std::thread(span).join();
+        tracer.getEvents(events, threads);
+        EXPECT_EQ(events.size(), 1u);
+        EXPECT_EQ(tracer.getBufferCount(), base + 1);
+    }
+
+    // A buffer emptied before its thread exits is freed with it
+    std::thread([&tracer] {
+        Tracer::record("span", 1, 2);
+        tracer.clear();
+    }).join();
+    EXPECT_EQ(tracer.getBufferCount(), base);
+
+    tracer.clear();
+    EXPECT_EQ(tracer.getBufferCount(), base);
+}
+
+TEST_F(TraceTest, ChromeJsonExport)
+{
+    Tracer::setEnabled(true);
+    nestedSpans(3);
+    {
+        AU_TRACE_SCOPE("quoted \"name\"");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    Tracer::setEnabled(false);
+
+    std::ostringstream out;
+    out.precision(2); // Must not affect the export
+    Tracer::get().exportChromeJson(out);
+    std::string json = out.str();
+
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"displayTimeUnit\":\"ns\"}"), std::string::npos);
+    EXPECT_EQ(countOf(json, "\"ph\":\"X\""), 7u);
+    EXPECT_EQ(countOf(json, "\"name\":\"outer\""), 3u);
+    EXPECT_NE(json.find("\"name\":\"quoted \\\"name\\\"\""), std::string::npos);
+
+    // The sleeping span lasted at least 2000 us
+    size_t span = json.find("quoted");
+    size_t dur  = json.find("\"dur\":", span);
+    ASSERT_NE(dur, std::string::npos);
+    double us = std::stod(json.substr(dur + 6));
+    EXPECT_GE(us, 1900.0);
+    EXPECT_LT(us, 1e6);
+    EXPECT_EQ(out.precision(), 2);
+}
+
+} // namespace
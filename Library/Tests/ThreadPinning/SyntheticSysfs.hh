@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#pragma once
+
+#include "Au/ThreadPinning/ThreadPinning.hh"
+#include "Au/Types.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+using namespace Au;
+
+/**
+ * @brief   A fake /sys/devices/system tree in a temporary directory.
+ *
+ * @details Writes the files CpuTopology reads (cpu/online,
+ * cpu<id>/topology/thread_siblings, level, type and shared_cpu_map of
+ * cpu<id>/cache/index<n> and node/node<id>/cpulist) in the kernel formats, so that topologies much
+ * larger than the build machine can be read with CpuTopology(root()).
+ * The tree is removed by the destructor.
+ */
+class SyntheticSysfs
+{
+  public:
+    SyntheticSysfs()
+        : m_root{}
+    {
+        std::string tmpl = (std::filesystem::temp_directory_path()
+                            / "au_sysfs_XXXXXX")
+                               .string();
+        if (mkdtemp(tmpl.data()) != nullptr)
+            m_root = tmpl;
+    }
+
+    ~SyntheticSysfs()
+    {
+        std::error_code ec;
+        if (!m_root.empty())
+            std::filesystem::remove_all(m_root, ec);
+    }
+
+    SyntheticSysfs(const SyntheticSysfs&)            = delete;
+    SyntheticSysfs& operator=(const SyntheticSysfs&) = delete;
+
+    const std::string& root() const { return m_root; }
+
+    /**
+     * @brief   Format processor ids like a sysfs cpumap
+     *
+     * @details Comma separated 32 bit hex words, most significant first,
+     * with as many words as needed for nrCpus processors.
+     */
+    static std::string cpuMap(const std::vector<int>& cpus, int nrCpus)
+    {
+        std::vector<Uint32> words((nrCpus + 31) / 32, 0);
+        for (int cpu : cpus) {
+            words[cpu / 32] |= Uint32(1) << (cpu % 32);
+        }
+        std::string map;
+        char        word[16];
+        for (size_t i = words.size(); i > 0; i--) {
+            snprintf(word, sizeof(word), "%08x", words[i - 1]);
+            map += word;
+            if (i > 1)
+                map += ",";
+        }
+        return map;
+    }
+
+    /**
+     * @brief   Format processor ids like a sysfs cpulist, e.g. "0-3,8"
+     */
+    static std::string cpuList(const std::vector<int>& cpus)
+    {
+        std::string list;
+        for (size_t i = 0; i < cpus.size(); i++) {
+            size_t last = i;
+            while (last + 1 < cpus.size() && cpus[last + 1] == cpus[last] + 1)
+                last++;
+            if (!list.empty())
+                list += ",";
+            list += std::to_string(cpus[i]);
+            if (last != i)
+                list += "-" + std::to_string(cpus[last]);
+            i = last;
+        }
+        return list;
+    }
+
+    void setOnline(const std::vector<int>& cpus)
+    {
+        write("cpu/online", cpuList(cpus));
+    }
+
+    void addCpu(int                     cpu,
+                const std::vector<int>& siblings,
+                const std::vector<int>& l3,
+                int                     nrCpus)
+    {
+        std::string dir = "cpu/cpu" + std::to_string(cpu);
+        write(dir + "/topology/thread_siblings", cpuMap(siblings, nrCpus));
+        addCache(cpu, 3, 3, "Unified", l3, nrCpus);
+    }
+
+    void addCache(int                     cpu,
+                  int                     index,
+                  int                     level,
+                  const char*             type,
+                  const std::vector<int>& cpus,
+                  int                     nrCpus)
+    {
+        std::string dir = "cpu/cpu" + std::to_string(cpu) + "/cache/index"
+                          + std::to_string(index);
+        write(dir + "/level", std::to_string(level));
+        write(dir + "/type", type);
+        write(dir + "/shared_cpu_map", cpuMap(cpus, nrCpus));
+    }
+
+    void addNode(int node, const std::vector<int>& cpus)
+    {
+        write("node/node" + std::to_string(node) + "/cpulist", cpuList(cpus));
+    }
+
+    /**
+     * @brief   Create a regular topology
+     *
+     * @details Processors are numbered like Linux does on AMD systems: the
+     * first hardware thread of every core first, the SMT siblings after that,
+     * i.e. core c owns processors c, c + cores, ... Every core has a private
+     * L2, cores are split evenly into L3 caches and NUMA nodes in order.
+     *
+     * @param[in] cores         Number of physical cores
+     * @param[in] smt           Hardware threads per core
+     * @param[in] coresPerL3    Cores sharing an L3 cache
+     * @param[in] nodes         Number of NUMA nodes
+     */
+    void build(int cores, int smt, int coresPerL3, int nodes)
+    {
+        int nrCpus = cores * smt;
+        auto threadsOf = [&](int firstCore, int count) {
+            std::vector<int> cpus;
+            for (int thread = 0; thread < smt; thread++) {
+                for (int core = firstCore; core < firstCore + count; core++) {
+                    cpus.push_back(core + thread * cores);
+                }
+            }
+            std::sort(cpus.begin(), cpus.end());
+            return cpus;
+        };
+
+        std::vector<int> all(nrCpus);
+        for (int cpu = 0; cpu < nrCpus; cpu++) {
+            all[cpu] = cpu;
+        }
+        setOnline(all);
+        for (int core = 0; core < cores; core++) {
+            int              l3       = core / coresPerL3 * coresPerL3;
+            std::vector<int> siblings = threadsOf(core, 1);
+            std::vector<int> cache    = threadsOf(l3, coresPerL3);
+            for (int cpu : siblings) {
+                addCpu(cpu, siblings, cache, nrCpus);
+                addCache(cpu, 2, 2, "Unified", siblings, nrCpus);
+            }
+        }
+        int coresPerNode = cores / nodes;
+        for (int node = 0; node < nodes; node++) {
+            addNode(node, threadsOf(node * coresPerNode, coresPerNode));
+        }
+    }
+
+  private:
+    void write(const std::string& path, const std::string& content)
+    {
+        std::filesystem::path file = std::filesystem::path(m_root) / path;
+        std::filesystem::create_directories(file.parent_path());
+        std::ofstream(file) << content << "\n";
+    }
+
+    std::string m_root;
+};
+
+} // namespace
@@ -1,6 +1,6 @@
 
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -67,8 +67,7 @@ TEST_F(PinThreadsTest, capiVerifyCustom)
     // initilize the affinity vector with random numbers less than hardware
     // concurrency
     for (int i = 0; i < num_threads; i++) {
-        affinityVector.push_back(rand()
-                                 % (std::thread::hardware_concurrency() - 1));
+        affinityVector.push_back(randomCpu());
     }
     au_pin_threads_custom(threadList,
                           thread_ids.size(),
@@ -77,21 +76,84 @@ TEST_F(PinThreadsTest, capiVerifyCustom)
     EXPECT_TRUE(VerifyAffinity(affinityVector));
 }
 
-#if AU_ENABLE_ASSERTS == 1
-// Negative test case
+TEST_F(PinThreadsTest, capiVerifyNumaCompact)
+{
+    // Test NUMA compact strategy and the reported nodes
+    strategy                    = pinStrategy::NUMA_COMPACT;
+    pthread_t*       threadList = &thread_ids[0];
+    std::vector<int> numaNodes(thread_ids.size(), -2);
+    EXPECT_EQ(au_pin_threads_numa_compact(
+                  threadList, thread_ids.size(), &numaNodes[0]),
+              (au_error_t)eError_Ok);
+    EXPECT_TRUE(VerifyAffinity());
+
+    AffinityVector   av;
+    std::vector<int> affinityVector(thread_ids.size());
+    std::vector<int> expectedNodes;
+    av.getAffinityVector(affinityVector, strategy);
+    av.getNumaNodes(affinityVector, expectedNodes);
+    EXPECT_EQ(numaNodes, expectedNodes);
+    for (int node : numaNodes) {
+        EXPECT_GE(node, -1);
+    }
+}
+
+TEST_F(PinThreadsTest, capiVerifyNumaSpread)
+{
+    // Test NUMA spread strategy, numaNodes may be NULL
+    strategy              = pinStrategy::NUMA_SPREAD;
+    pthread_t* threadList = &thread_ids[0];
+    EXPECT_EQ(au_pin_threads_numa_spread(threadList, thread_ids.size(), NULL),
+              (au_error_t)eError_Ok);
+    EXPECT_TRUE(VerifyAffinity());
+}
+
+TEST_F(PinThreadsTest, capiVerifyCacheSpread)
+{
+    // Test spread over the L2 caches
+    pthread_t*       threadList = &thread_ids[0];
+    AffinityVector   av;
+    std::vector<int> affinityVector(thread_ids.size());
+    av.getAffinityVector(affinityVector, pinStrategy::SPREAD, 2);
+    EXPECT_EQ(au_pin_threads_cache_spread(threadList, thread_ids.size(), 2),
+              (au_error_t)eError_Ok);
+    EXPECT_TRUE(VerifyAffinity(affinityVector));
+}
+
+TEST_F(PinThreadsTest, capiVerifyCacheCompact)
+{
+    // Test cache compact strategy on L3
+    strategy              = pinStrategy::CACHE_COMPACT;
+    pthread_t* threadList = &thread_ids[0];
+    EXPECT_EQ(au_pin_threads_cache_compact(threadList, thread_ids.size(), 3),
+              (au_error_t)eError_Ok);
+    EXPECT_TRUE(VerifyAffinity());
+}
+
+TEST(ThreadPinningCapiTest, capiTopologyInit)
+{
+    // Reads the topology once, repeated calls are harmless
+    au_topology_init();
+    au_topology_init();
+    EXPECT_GT(CpuTopology::get().active_processors, 0u);
+    EXPECT_FALSE(CpuTopology::get().processorMap.empty());
+}
+
+// Negative test case, a processor outside the allowed set is an error
 TEST_F(PinThreadsNegativeTest, capiVerifyInvalidcorenumber)
 {
     // Test custom strategy
     pthread_t*       threadList = &thread_ids[0];
-    std::vector<int> affinityVector(thread_ids.size(),
-                                    std::thread::hardware_concurrency() + 1);
+    std::vector<int> affinityVector(thread_ids.size(), 1 << 20);
 
-    EXPECT_ANY_THROW(au_pin_threads_custom(threadList,
-                                           thread_ids.size(),
-                                           &affinityVector[0],
-                                           affinityVector.size()));
+    EXPECT_EQ(au_pin_threads_custom(threadList,
+                                    thread_ids.size(),
+                                    &affinityVector[0],
+                                    affinityVector.size()),
+              (au_error_t)eError_InvalidArgument);
 }
 
+#if AU_ENABLE_ASSERTS == 1
 TEST_F(PinThreadsNegativeTest, capiVerifyNullThreadList)
 {
     // Test custom strategy
@@ -101,8 +163,7 @@ TEST_F(PinThreadsNegativeTest, capiVerifyNullThreadList)
     // initilize the affinity vector with random numbers less than hardware
     // concurrency
     for (int i = 0; i < num_threads; i++) {
-        affinityVector.push_back(rand()
-                                 % (std::thread::hardware_concurrency() - 1));
+        affinityVector.push_back(randomCpu());
     }
     EXPECT_ANY_THROW(au_pin_threads_custom(threadList,
                                            thread_ids.size(),
@@ -127,8 +188,7 @@ TEST_F(PinThreadsNegativeTest, capiVerifyInvalidAffinityVector)
     // initilize the affinity vector with random numbers less than hardware
     // concurrency
     for (int i = 0; i < num_threads; i++) {
-        affinityVector.push_back(rand()
-                                 % (std::thread::hardware_concurrency() - 1));
+        affinityVector.push_back(randomCpu());
     }
     EXPECT_ANY_THROW(au_pin_threads_custom(threadList,
                                            thread_ids.size(),
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -49,6 +49,11 @@ class MockCpuTopology : public CpuTopology
     {
         groupMap = gMap;
     }
+    void setNMap(std::vector<std::vector<std::pair<KAFFINITY, int>>> nMap)
+    {
+        nodeMap = nMap;
+    }
+    void setCaches(std::vector<CacheLevel> levels) { caches = levels; }
 };
 
 INSTANTIATE_TEST_SUITE_P(
@@ -149,4 +154,133 @@ TEST_P(ThreadPinningTest, affinityVectorTest)
     EXPECT_EQ(processPinGroup, SpreadResult);
 }
 
+/*
+ * 16 logical processors on 8 SMT cores (i and i + 8 are siblings), two NUMA
+ * nodes: node 0 holds cores 0-3, node 1 holds cores 4-7.
+ */
+static MockCpuTopology
+numaTopology()
+{
+    std::vector<std::vector<std::pair<KAFFINITY, int>>> pMap;
+    for (int i = 0; i < 8; i++) {
+        pMap.push_back({ { (1UL << i) | (1UL << (i + 8)), 0 } });
+    }
+    MockCpuTopology mockCT;
+    mockCT.setActiveProcessors(16);
+    mockCT.setPMap(pMap);
+    mockCT.setCMap({ { { 0xffff, 0 } } });
+    mockCT.setGMap({ { 0xffff, 16 } });
+    mockCT.setNMap({ { { 0x0f0f, 0 } }, { { 0xf0f0, 0 } } });
+    return mockCT;
+}
+
+TEST(ThreadPinningNumaTest, NumaCompact)
+{
+    MockCpuTopology  mockCT = numaTopology();
+    auto             av     = AffinityVector(mockCT);
+    std::vector<int> processPinGroup(10), numaNodes;
+
+    av.getAffinityVector(processPinGroup, pinStrategy::NUMA_COMPACT);
+    EXPECT_EQ(processPinGroup,
+              std::vector<int>({ 0, 1, 2, 3, 8, 9, 10, 11, 4, 5 }));
+
+    av.getNumaNodes(processPinGroup, numaNodes);
+    EXPECT_EQ(numaNodes, std::vector<int>({ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1 }));
+}
+
+TEST(ThreadPinningNumaTest, NumaSpread)
+{
+    MockCpuTopology  mockCT = numaTopology();
+    auto             av     = AffinityVector(mockCT);
+    std::vector<int> processPinGroup(6), numaNodes;
+
+    av.getAffinityVector(processPinGroup, pinStrategy::NUMA_SPREAD);
+    EXPECT_EQ(processPinGroup, std::vector<int>({ 0, 1, 2, 4, 5, 6 }));
+
+    av.getNumaNodes(processPinGroup, numaNodes);
+    EXPECT_EQ(numaNodes, std::vector<int>({ 0, 0, 0, 1, 1, 1 }));
+}
+
+TEST(ThreadPinningNumaTest, SystemTopology)
+{
+    CpuTopology      cpuTopology;
+    auto             av = AffinityVector(cpuTopology);
+    std::vector<int> numaNodes;
+
+    EXPECT_FALSE(cpuTopology.nodeMap.empty());
+    av.getNumaNodes({ 0 }, numaNodes);
+    ASSERT_EQ(numaNodes.size(), 1U);
+    EXPECT_GE(numaNodes[0], 0);
+}
+
+/*
+ * The processors of numaTopology() with a private L1 and L2 per core, an L1
+ * instruction cache shared by all, to check it is skipped, and two L3 of
+ * four cores each.
+ */
+static MockCpuTopology
+cacheTopology()
+{
+    std::vector<std::vector<std::pair<KAFFINITY, int>>> perCore;
+    for (int i = 0; i < 8; i++) {
+        perCore.push_back({ { (1UL << i) | (1UL << (i + 8)), 0 } });
+    }
+    std::vector<std::vector<std::pair<KAFFINITY, int>>> l3 = {
+        { { 0x0f0f, 0 } }, { { 0xf0f0, 0 } }
+    };
+    MockCpuTopology mockCT = numaTopology();
+    mockCT.setCMap(l3);
+    mockCT.setCaches({ { 1, CacheType::eInstruction, { { { 0xffff, 0 } } } },
+                       { 1, CacheType::eData, perCore },
+                       { 2, CacheType::eUnified, perCore },
+                       { 3, CacheType::eUnified, l3 } });
+    return mockCT;
+}
+
+TEST(ThreadPinningCacheTest, SpreadLevel)
+{
+    MockCpuTopology  mockCT = cacheTopology();
+    auto             av     = AffinityVector(mockCT);
+    std::vector<int> processPinGroup(8);
+
+    // One thread per L2
+    av.getAffinityVector(processPinGroup, pinStrategy::SPREAD, 2);
+    EXPECT_EQ(processPinGroup, std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7 }));
+
+    processPinGroup.resize(4);
+    av.getAffinityVector(processPinGroup, pinStrategy::SPREAD, 1);
+    EXPECT_EQ(processPinGroup, std::vector<int>({ 0, 2, 4, 6 }));
+
+    // Unknown levels use L3
+    processPinGroup.resize(2);
+    av.getAffinityVector(processPinGroup, pinStrategy::SPREAD, 4);
+    EXPECT_EQ(processPinGroup, std::vector<int>({ 0, 4 }));
+}
+
+TEST(ThreadPinningCacheTest, CacheCompact)
+{
+    MockCpuTopology  mockCT = cacheTopology();
+    auto             av     = AffinityVector(mockCT);
+    std::vector<int> processPinGroup(6);
+
+    // Fill one L3 before the next
+    av.getAffinityVector(processPinGroup, pinStrategy::CACHE_COMPACT);
+    EXPECT_EQ(processPinGroup, std::vector<int>({ 0, 1, 2, 3, 8, 9 }));
+
+    processPinGroup.resize(3);
+    av.getAffinityVector(processPinGroup, pinStrategy::CACHE_COMPACT, 2);
+    EXPECT_EQ(processPinGroup, std::vector<int>({ 0, 8, 1 }));
+}
+
+#ifdef __linux__
+TEST(ThreadPinningNumaTest, ParseCpuList)
+{
+    std::vector<std::pair<KAFFINITY, int>> map;
+    CpuTopology::parseCpuList(map, "0-3,8,40-41\n");
+    EXPECT_EQ(map,
+              (std::vector<std::pair<KAFFINITY, int>>{ { 0x10f, 0 },
+                                                       { 0x300, 1 } }));
+}
+#endif
+
 } // namespace
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "Au/Error.hh"
+#include "SyntheticSysfs.hh"
+#include "gtest/gtest.h"
+
+#include <numeric>
+
+namespace {
+
+std::vector<int>
+iota(int count, int first = 0)
+{
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), first);
+    return values;
+}
+
+/* 192 cores with SMT, 8 cores per L3, 2 sockets */
+TEST(ThreadPinningSysfsTest, Turin)
+{
+    SyntheticSysfs sysfs;
+    ASSERT_FALSE(sysfs.root().empty());
+    sysfs.build(192, 2, 8, 2);
+
+    CpuTopology cpuTopology(sysfs.root());
+    EXPECT_EQ(cpuTopology.active_processors, 384U);
+    EXPECT_EQ(cpuTopology.processorMap.size(), 192U);
+    EXPECT_EQ(cpuTopology.cacheMap.size(), 24U);
+    EXPECT_EQ(cpuTopology.nodeMap.size(), 2U);
+    EXPECT_EQ(cpuTopology.groupMap.size(), 12U);
+    ASSERT_EQ(cpuTopology.caches.size(), 2U);
+    EXPECT_EQ(cpuTopology.caches[0].level, 2);
+    EXPECT_EQ(cpuTopology.caches[0].map.size(), 192U);
+    EXPECT_EQ(cpuTopology.caches[1].level, 3);
+    EXPECT_EQ(cpuTopology.caches[1].map, cpuTopology.cacheMap);
+
+    auto             av = AffinityVector(cpuTopology);
+    std::vector<int> processPinGroup(384);
+    av.getAffinityVector(processPinGroup, pinStrategy::CORE);
+    EXPECT_EQ(processPinGroup, iota(384));
+
+    processPinGroup.resize(192);
+    av.getAffinityVector(processPinGroup, pinStrategy::SPREAD, 2);
+    EXPECT_EQ(processPinGroup, iota(192));
+
+    processPinGroup.resize(24);
+    av.getAffinityVector(processPinGroup, pinStrategy::SPREAD);
+    for (int cache = 0; cache < 24; cache++) {
+        EXPECT_EQ(processPinGroup[cache], cache * 8);
+    }
+
+    // One CCX, then the next
+    processPinGroup.resize(17);
+    av.getAffinityVector(processPinGroup, pinStrategy::CACHE_COMPACT);
+    EXPECT_EQ(processPinGroup[7], 7);
+    EXPECT_EQ(processPinGroup[8], 192);
+    EXPECT_EQ(processPinGroup[16], 8);
+
+    std::vector<int> numaNodes;
+    processPinGroup.resize(4);
+    av.getAffinityVector(processPinGroup, pinStrategy::NUMA_SPREAD);
+    av.getNumaNodes(processPinGroup, numaNodes);
+    EXPECT_EQ(processPinGroup, std::vector<int>({ 0, 1, 96, 97 }));
+    EXPECT_EQ(numaNodes, std::vector<int>({ 0, 0, 1, 1 }));
+}
+
+/* 4096 logical processors, 16 cores per L3, 8 nodes */
+TEST(ThreadPinningSysfsTest, Cpus4096)
+{
+    SyntheticSysfs sysfs;
+    ASSERT_FALSE(sysfs.root().empty());
+    sysfs.build(2048, 2, 16, 8);
+
+    CpuTopology cpuTopology(sysfs.root());
+    EXPECT_EQ(cpuTopology.active_processors, 4096U);
+    EXPECT_EQ(cpuTopology.processorMap.size(), 2048U);
+    EXPECT_EQ(cpuTopology.cacheMap.size(), 128U);
+    EXPECT_EQ(cpuTopology.nodeMap.size(), 8U);
+
+    auto             av = AffinityVector(cpuTopology);
+    std::vector<int> processPinGroup(4096);
+    av.getAffinityVector(processPinGroup, pinStrategy::CORE);
+    EXPECT_EQ(processPinGroup, iota(4096));
+
+    av.getAffinityVector(processPinGroup, pinStrategy::LOGICAL);
+    EXPECT_EQ(processPinGroup, iota(4096));
+
+    std::vector<int> numaNodes;
+    av.getAffinityVector(processPinGroup, pinStrategy::NUMA_COMPACT);
+    av.getNumaNodes(processPinGroup, numaNodes);
+    for (int thread = 0; thread < 4096; thread++) {
+        // 256 cores and their 256 siblings per node
+        EXPECT_EQ(numaNodes[thread], thread / 512);
+        EXPECT_EQ(processPinGroup[thread] % 2048 / 256, thread / 512);
+    }
+
+    processPinGroup.resize(128);
+    av.getAffinityVector(processPinGroup, pinStrategy::SPREAD);
+    for (int cache = 0; cache < 128; cache++) {
+        EXPECT_EQ(processPinGroup[cache], cache * 16);
+    }
+}
+
+/* Processors 16-63 are offline, the ids have to stay those of the kernel */
+TEST(ThreadPinningSysfsTest, SparseCpus)
+{
+    SyntheticSysfs sysfs;
+    ASSERT_FALSE(sysfs.root().empty());
+
+    std::vector<int> online = iota(16);
+    for (int cpu : iota(16, 64)) {
+        online.push_back(cpu);
+    }
+    sysfs.setOnline(online);
+    for (int cpu : online) {
+        sysfs.addCpu(cpu, { cpu }, online, 80);
+    }
+    sysfs.addNode(0, online);
+
+    CpuTopology cpuTopology(sysfs.root());
+    EXPECT_EQ(cpuTopology.active_processors, 32U);
+    EXPECT_EQ(cpuTopology.processorMap.size(), 32U);
+
+    auto             av = AffinityVector(cpuTopology);
+    std::vector<int> processPinGroup(32);
+    av.getAffinityVector(processPinGroup, pinStrategy::CORE);
+    EXPECT_EQ(processPinGroup, online);
+
+    av.getAffinityVector(processPinGroup, pinStrategy::SPREAD);
+    std::sort(processPinGroup.begin(), processPinGroup.end());
+    EXPECT_EQ(processPinGroup, online);
+
+    av.getAffinityVector(processPinGroup, pinStrategy::LOGICAL);
+    EXPECT_EQ(processPinGroup, online);
+}
+
+/* A cpuset of cores 0-3 and their siblings, all strategies stay inside it */
+TEST(ThreadPinningSysfsTest, AllowedSet)
+{
+    SyntheticSysfs sysfs;
+    ASSERT_FALSE(sysfs.root().empty());
+    sysfs.build(8, 2, 4, 2);
+
+    CpuTopology           cpuTopology(sysfs.root());
+    std::vector<CoreMask> allowed;
+    CpuTopology::parseCpuList(allowed, "0-3,8-11");
+    cpuTopology.restrict(allowed);
+    EXPECT_EQ(cpuTopology.active_processors, 8U);
+    EXPECT_EQ(cpuTopology.processorMap.size(), 4U);
+    EXPECT_EQ(cpuTopology.cacheMap.size(), 1U);
+    EXPECT_EQ(cpuTopology.nodeMap.size(), 2U);
+    EXPECT_TRUE(cpuTopology.nodeMap[1].empty());
+
+    std::vector<int> inSet = { 0, 1, 2, 3, 8, 9, 10, 11 };
+    auto             av    = AffinityVector(cpuTopology);
+    std::vector<int> processPinGroup(8);
+    av.getAffinityVector(processPinGroup, pinStrategy::LOGICAL);
+    EXPECT_EQ(processPinGroup, inSet);
+
+    av.getAffinityVector(processPinGroup, pinStrategy::CORE);
+    EXPECT_EQ(processPinGroup, inSet);
+
+    for (int strategy = pinStrategy::SPREAD;
+         strategy <= pinStrategy::CACHE_COMPACT;
+         strategy++) {
+        processPinGroup.assign(16, -1);
+        av.getAffinityVector(processPinGroup, strategy);
+        for (int cpu : processPinGroup) {
+            EXPECT_TRUE(av.isAllowed(cpu)) << cpu << " " << strategy;
+        }
+    }
+    EXPECT_FALSE(av.isAllowed(4));
+    EXPECT_FALSE(av.isAllowed(15));
+}
+
+/* Pinning outside the allowed set of the process is an error, not a crash */
+TEST(ThreadPinningSysfsTest, PinOutsideAllowedSet)
+{
+    AffinityVector av;
+    Status         status = av.pinThread(pthread_self(), 1 << 20);
+    EXPECT_FALSE(status.ok());
+    EXPECT_EQ(status.code(), InvalidArgumentError().code());
+    status = av.pinThread(pthread_self(), -1);
+    EXPECT_EQ(status.code(), InvalidArgumentError().code());
+}
+
+TEST(ThreadPinningSysfsTest, CpuMapFormat)
+{
+    EXPECT_EQ(SyntheticSysfs::cpuMap({ 0, 33 }, 64), "00000002,00000001");
+    EXPECT_EQ(SyntheticSysfs::cpuList({ 0, 1, 2, 5, 7, 8 }), "0-2,5,7-8");
+
+    std::vector<CoreMask> map;
+    CpuTopology::parseCpuList(map, SyntheticSysfs::cpuList(iota(40, 8)));
+    EXPECT_EQ(map,
+              (std::vector<CoreMask>{ { 0xffffff00, 0 }, { 0xffff, 1 } }));
+}
+
+} // namespace
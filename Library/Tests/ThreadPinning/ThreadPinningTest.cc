@@ -26,6 +26,7 @@
  *
  */
 
+#include "Au/Error.hh"
 #include "ThreadPinningTest.hh"
 namespace {
 
@@ -55,22 +56,23 @@ TEST_F(PinThreadsTest, verifyCustom)
     std::vector<int> AffinityVector{};
     verifyStrategy(AffinityVector);
 }
+TEST_F(PinThreadsNegativeTest, verifyInvalidAffinity)
+{
+    // Test invalid affinity, reported instead of asserted
+    std::vector<int> AffinityVector(thread_ids.size(), 1 << 20);
+    Status           status = tp.pinThreads(thread_ids, AffinityVector);
+    EXPECT_FALSE(status.ok());
+    EXPECT_EQ(status.code(), InvalidArgumentError().code());
+}
+
 #if AU_ENABLE_ASSERTIONS == 1
 TEST_F(PinThreadsNegativeTest, verifyInvalidStrategy)
 {
     // Test invalid strategy
-    int strategy = 5;
+    int strategy = pinStrategy::CACHE_COMPACT + 1;
     EXPECT_ANY_THROW(tp.pinThreads(thread_ids, strategy));
 }
 
-TEST_F(PinThreadsNegativeTest, verifyInvalidAffinity)
-{
-    // Test invalid affinity
-    std::vector<int> AffinityVector(thread_ids.size(),
-                                    std::thread::hardware_concurrency() + 1);
-    EXPECT_ANY_THROW(tp.pinThreads(thread_ids, AffinityVector));
-}
-
 TEST_F(PinThreadsNegativeTest, verifyInvalidAffinitySize)
 {
     // Test invalid affinity size
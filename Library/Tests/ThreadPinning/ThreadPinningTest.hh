@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -27,6 +27,7 @@
  */
 #include "Au/ThreadPinning.hh"
 #include "Au/ThreadPinning/ThreadPinning.hh"
+#include <algorithm>
 #include <climits> // for CHAR_BIT
 #include <fstream>
 #include <gtest/gtest.h>
@@ -74,8 +75,8 @@ class PinThreadsTest : public ::testing::Test
     void SetUp() override
     {
 
-        num_threads = std::thread::hardware_concurrency()
-                      + rand() % (std::thread::hardware_concurrency() - 1);
+        num_threads =
+            std::thread::hardware_concurrency() + rand() % spareCpus();
         createThreads();
         for (int i = 0; i < num_threads; ++i) {
             pthread_t handle = threads[i].native_handle();
@@ -101,6 +102,32 @@ class PinThreadsTest : public ::testing::Test
         }
     }
 
+    /**
+     * @brief           spareCpus
+     *
+     * @details         Number of processors but one, at least 1 so single
+     * processor machines do not divide by 0
+     *
+     * @param           void
+     *
+     * @return          unsigned int
+     */
+    static unsigned int spareCpus()
+    {
+        return std::max(std::thread::hardware_concurrency() - 1, 1u);
+    }
+
+    /**
+     * @brief           randomCpu
+     *
+     * @details         Random CPU below spareCpus()
+     *
+     * @param           void
+     *
+     * @return          int
+     */
+    static int randomCpu() { return rand() % spareCpus(); }
+
   private:
     /**
      * @brief           printThreadId
@@ -289,7 +316,7 @@ class PinThreadsTest : public ::testing::Test
 
         // with number of threads less than hardware concurrency
         num_threads = std::thread::hardware_concurrency()
-                      - (rand() % std::thread::hardware_concurrency() - 1);
+                      - rand() % std::thread::hardware_concurrency();
         std::vector<pthread_t> threadIds2(thread_ids.begin(),
                                           thread_ids.begin() + num_threads);
         tp.pinThreads(threadIds2, strategy);
@@ -310,8 +337,7 @@ class PinThreadsTest : public ::testing::Test
         // initilize the affinity vector with random numbers less than hardware
         // concurrency
         for (int i = 0; i < num_threads; i++) {
-            affinityVector.push_back(
-                rand() % (std::thread::hardware_concurrency() - 1));
+            affinityVector.push_back(randomCpu());
         }
         // with number of threads more than hardware concurrency
         tp.pinThreads(thread_ids, affinityVector);
@@ -321,8 +347,7 @@ class PinThreadsTest : public ::testing::Test
         num_threads = std::thread::hardware_concurrency();
         affinityVector.clear();
         for (int i = 0; i < num_threads; i++) {
-            affinityVector.push_back(
-                rand() % (std::thread::hardware_concurrency() - 1));
+            affinityVector.push_back(randomCpu());
         }
         std::vector<pthread_t> threadIds1(thread_ids.begin(),
                                           thread_ids.begin() + num_threads);
@@ -331,11 +356,10 @@ class PinThreadsTest : public ::testing::Test
 
         // with number of threads less than hardware concurrency
         num_threads = std::thread::hardware_concurrency()
-                      - (rand() % std::thread::hardware_concurrency() - 1);
+                      - rand() % std::thread::hardware_concurrency();
         affinityVector.clear();
         for (int i = 0; i < num_threads; i++) {
-            affinityVector.push_back(
-                rand() % (std::thread::hardware_concurrency() - 1));
+            affinityVector.push_back(randomCpu());
         }
         std::vector<pthread_t> threadIds2(thread_ids.begin(),
                                           thread_ids.begin() + num_threads);
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Cost of reading the processor topology at startup. Built with
+ * AU_ENABLE_SLOW_TESTS on Linux.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "Au/ThreadPinning.hh"
+#include "Capi/au/threadpinning.h"
+#include "SyntheticSysfs.hh"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr int cIterations = 20;
+
+template<typename Fn>
+double
+usPerCall(Fn&& fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cIterations; i++) {
+        fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count()
+           / cIterations;
+}
+
+/* What the loader used to do: walk cpu/ twice and read every file of every
+ * processor through a stream */
+size_t
+streamLoad(const std::string& root)
+{
+    size_t words = 0;
+    for (const char* file :
+         { "/topology/thread_siblings", "/cache/index3/shared_cpu_map" }) {
+        DIR* dirp = opendir((root + "/cpu/").c_str());
+        if (dirp == nullptr)
+            return 0;
+        struct dirent* dp;
+        while ((dp = readdir(dirp)) != nullptr) {
+            std::string dirName(dp->d_name);
+            if (dirName.find("cpu") != 0 || !isdigit(dirName[3]))
+                continue;
+            std::ifstream stream(root + "/cpu/" + dirName + file);
+            std::string   line;
+            if (!getline(stream, line))
+                continue;
+            std::reverse(line.begin(), line.end());
+            std::stringstream ss(line);
+            std::string       chunk;
+            while (std::getline(ss, chunk, ',')) {
+                std::reverse(chunk.begin(), chunk.end());
+                words += std::stoull(chunk, nullptr, 16) != 0;
+            }
+        }
+        closedir(dirp);
+    }
+    return words;
+}
+
+void
+report(const char* name, const std::string& root)
+{
+    volatile size_t sink   = 0;
+    double          stream = usPerCall([&] { sink = streamLoad(root); });
+    double          loader = usPerCall([&] {
+        CpuTopology cpuTopology(root);
+        sink = cpuTopology.processorMap.size();
+    });
+
+    std::cout << name << " stream reads  : " << stream << " us\n"
+              << name << " CpuTopology   : " << loader << " us\n";
+}
+
+TEST(TopologyBench, Startup)
+{
+    report("System       ", cSysfsRoot);
+
+    SyntheticSysfs sysfs;
+    ASSERT_FALSE(sysfs.root().empty());
+    sysfs.build(2048, 2, 16, 8);
+    report("4096 threads ", sysfs.root());
+}
+
+TEST(TopologyBench, FirstPin)
+{
+    // The first call reads the topology, later ones use the snapshot
+    auto   start = std::chrono::steady_clock::now();
+    au_topology_init();
+    double init = std::chrono::duration<double, std::micro>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+    double again = usPerCall([] { au_topology_init(); });
+
+    std::cout << "au_topology_init first : " << init << " us\n"
+              << "au_topology_init again : " << again << " us\n";
+
+    EXPECT_LT(again, init);
+}
+
+} // namespace
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * au_logdecode - prints a log written by Au::Logger::BinaryFileLogger or
+ * Au::Logger::MappedFileLogger as text
+ *
+ * Usage: au_logdecode <binary log> [<output file>]
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "Au/Logger/Logger.hh"
+
+namespace {
+bool
+isMappedLog(const char* filename)
+{
+    using Au::Logger::MappedFileLogger;
+    char          magic[sizeof(MappedFileLogger::cMagic)] = {};
+    std::ifstream file(filename, std::ios::binary);
+    return file.read(magic, sizeof(magic))
+           && std::memcmp(magic, MappedFileLogger::cMagic, sizeof(magic)) == 0;
+}
+
+bool
+decode(const char* filename, std::ostream& out)
+{
+    if (isMappedLog(filename)) {
+        return Au::Logger::MappedFileLogger::dump(filename, out);
+    }
+    return Au::Logger::BinaryLogDecoder::decodeFile(filename, out);
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " <binary log> [<output file>]"
+                  << std::endl;
+        return 1;
+    }
+
+    bool ok = false;
+    if (argc == 3) {
+        std::ofstream out(argv[2]);
+        if (!out.is_open()) {
+            std::cerr << "Error opening file: " << argv[2] << std::endl;
+            return 1;
+        }
+        ok = decode(argv[1], out);
+    } else {
+        ok = decode(argv[1], std::cout);
+    }
+
+    if (!ok) {
+        std::cerr << "Error decoding " << argv[1]
+                  << ": not a binary log or truncated" << std::endl;
+        return 1;
+    }
+    return 0;
+}
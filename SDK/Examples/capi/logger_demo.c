@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2025-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -40,6 +40,7 @@ log_capi()
     au_logger_log(logger, "This is warn message", AUD_LOG_LEVEL_WARN);
     au_logger_log(logger, "This is error message", AUD_LOG_LEVEL_ERROR);
     au_logger_log(logger, "This is fatal message", AUD_LOG_LEVEL_FATAL);
+    au_logger_logf(logger, AUD_LOG_LEVEL_INFO, "%d of %s", 7, "formatted");
     au_logger_flush(logger);
     au_logger_destroy(logger);
 }
@@ -52,6 +53,7 @@ log_macro()
     AUD_LOG_WARN("This is warn message from macro");
     AUD_LOG_DEBUG("This is debug message from macro");
     AUD_LOG_TRACE("This is trace message from macro");
+    AUD_LOGF(AUD_LOG_LEVEL_INFO, "Formatted %s %.1f", "from macro", 1.5);
 }
 
 int
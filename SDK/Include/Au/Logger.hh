@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -28,15 +28,14 @@
 
 #pragma once
 
-#include <ctime>
-#include <fstream>
-#include <iomanip> // for std::hex
-#include <iostream>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <sstream>
-#include <string>
+#include <type_traits>
+#include <utility>
 
 #include "Au/Config.h"
-#include "Au/Logger.hh"
 #include "Au/Types.hh"
 
 namespace Au {
@@ -49,37 +48,43 @@ enum class LogLevel
     CRITICAL
 };
 
-class Logger
+namespace Logger {
+
+class FanOutLogger;
+
+/**
+ * @class LegacyLogger
+ * @brief Front end of the former synchronous Au::Logger class.
+ *
+ * Messages are formatted on the calling thread as before, but written by
+ * the LogWriter logging thread to whatever logger it has been given, the
+ * console by default. Obtain it with Au::Logger::getInstance().
+ *
+ * Au::Logger is now the namespace of the logging library, code naming the
+ * former class, e.g. "Au::Logger& log = Au::Logger::getInstance();", has
+ * to use Au::Logger::LegacyLogger or auto instead.
+ */
+class LegacyLogger
 {
   private:
-    LogLevel m_logLevel;
-    bool     m_logToFile;
-    Logger(LogLevel level = LogLevel::CRITICAL, bool logToFile = false)
-        : m_logLevel{ level }
-        , m_logToFile{ logToFile }
-    {
-        if (level < LogLevel::CRITICAL) {
-            m_logLevel = level;
-            return;
-        }
-        if (AU_BUILD_TYPE_RELEASE)
-            m_logLevel = LogLevel::CRITICAL;
-        else if (AU_BUILD_TYPE_DEBUG)
-            m_logLevel = LogLevel::INFO;
-        else if (AU_BUILD_TYPE_DEVELOPER)
-            m_logLevel = LogLevel::DEBUG;
-    }
+    LogLevel                      m_logLevel;
+    std::atomic<bool>             m_logToFile; ///< m_file is set
+    std::unique_ptr<FanOutLogger> m_file;      ///< Sink of the legacy file
+    std::mutex                    m_fileMutex; ///< Guards m_file
+
+    LegacyLogger(LogLevel level = LogLevel::CRITICAL, bool logToFile = false);
+    ~LegacyLogger();
 
     /**
      * @brief Append variables to the message
-     * @param stream The stringstream to append to
+     * @param stream The stream to append to
      * @param value The value to append
      * @param args The rest of the values to append
      *
      * @return void
      */
     template<typename T, typename... Args>
-    void appendVariables(std::stringstream& stream, T&& value, Args&&... args)
+    void appendVariables(std::ostream& stream, T&& value, Args&&... args)
     {
         stream << " " << value;
         appendVariables(stream, std::forward<Args>(args)...);
@@ -88,63 +93,47 @@ class Logger
     /**
      * @brief Append variables to the message, The terminal condition for
      * appendVariables recursion
-     * @param stream The stringstream to append to
+     * @param stream The stream to append to
      *
      * @return void
      */
-    void appendVariables(std::stringstream& stream) {}
+    void appendVariables(std::ostream& stream) {}
 
     /**
-     * @brief Write the message to the log file
-     * @param message The message to write
-     *
-     * @return void
+     * @brief Get the stream of the calling thread, emptied and with default
+     * formatting, reused so a call does not construct a new stream
+     * @return The stream
      */
-    void writeToLogFile(const String& message)
-    {
-        std::ofstream logFile;
-        logFile.open("cpuidlog.txt", std::ios_base::app);
-        if (logFile.is_open()) {
-            logFile << message << std::endl;
-        }
-    }
+    static std::ostringstream& getStream();
 
     /**
-     * @brief Write the message to the console
-     * @param message The message to write
+     * @brief Queue the text of the stream to the LogWriter
+     * @param level The log level
+     * @param stream The stream holding the message
      *
      * @return void
      */
-    void writeToConsole(const String& message)
-    {
-        std::cout << message << std::endl;
-    }
+    void submit(LogLevel level, const std::ostringstream& stream);
 
   public:
-    Logger(Logger const&)         = delete;
-    void operator=(Logger const&) = delete;
+    LegacyLogger(LegacyLogger const&)   = delete;
+    void operator=(LegacyLogger const&) = delete;
 
     /**
      * @brief Get the logger instance
      * @return The logger instance
      */
-    static Logger& getInstance()
-    {
-        static Logger instance;
-        return instance;
-    }
+    static LegacyLogger& getInstance();
 
     /**
      * @brief Set the log level
      * @param level The log level
-     * @param logToFile If true, log to file
+     * @param logToFile If true, the messages of this logger are also written
+     * to "cpuidlog.txt" by a sink thread of their own. The logger of the
+     * LogWriter is left alone and never sees the file.
      * @return void
      */
-    void setLevel(LogLevel level, bool logToFile = false)
-    {
-        this->m_logLevel  = level;
-        this->m_logToFile = logToFile;
-    }
+    void setLevel(LogLevel level, bool logToFile = false);
 
     /**
      * @brief Log a message
@@ -161,41 +150,26 @@ class Logger
     {
         if (level < m_logLevel)
             return;
-        String logLevelStr;
-        switch (level) {
-            case LogLevel::DEBUG:
-                logLevelStr = "[DEBUG]";
-                break;
-            case LogLevel::INFO:
-                logLevelStr = "[INFO]";
-                break;
-            case LogLevel::WARNING:
-                logLevelStr = "[WARNING]";
-                break;
-            case LogLevel::ERROR:
-                logLevelStr = "[ERROR]";
-                break;
-            case LogLevel::CRITICAL:
-                logLevelStr = "[CRITICAL]";
-                break;
-        }
-
-        std::time_t now       = std::time(nullptr);
-        String timestamp = std::asctime(std::localtime(&now));
-        timestamp =
-            timestamp.substr(0, timestamp.length() - 1); // Remove newline
-
-        std::stringstream logMessageStream;
-        logMessageStream << timestamp << " " << logLevelStr << " " << message;
-        appendVariables(logMessageStream, std::forward<Args>(args)...);
-
-        String logMessage = logMessageStream.str();
-        if (m_logToFile)
-            writeToLogFile(logMessage);
-        writeToConsole(logMessage);
+        std::ostringstream& stream = getStream();
+        stream << message;
+        appendVariables(stream, std::forward<Args>(args)...);
+        submit(level, stream);
     }
 };
 
+/**
+ * @brief Get the legacy logger instance, keeps the former
+ * Au::Logger::getInstance() calls compiling
+ * @return The logger instance
+ */
+inline LegacyLogger&
+getInstance()
+{
+    return LegacyLogger::getInstance();
+}
+
+} // namespace Logger
+
 // Overload << operator for std::ostream to print variables in hex format
 template<typename T, class = enableIf<std::is_integral<T>>>
 std::ostream&
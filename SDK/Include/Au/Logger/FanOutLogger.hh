@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+#include "Au/Logger/Logger.hh"
+#include "Au/Logger/Queue.hh"
+
+#include <condition_variable>
+
+namespace Au::Logger {
+
+/**
+ * @brief Level mask accepting maxLevel and every higher priority, for
+ * FanOutLogger::addSink().
+ * @param maxLevel Lowest priority let through, e.g. eWarning for warnings,
+ * errors, panics and fatal messages.
+ * @return Mask of Priority::PriorityLevel bits.
+ */
+constexpr Uint32
+levelMaskUpTo(Priority::PriorityLevel maxLevel)
+{
+    // Higher priority levels have lower bits
+    return (static_cast<Uint32>(maxLevel) << 1) - 1;
+}
+
+/**
+ * @class FanOutLogger
+ * @brief Sends every message to several loggers ("sinks"), each with its own
+ * level mask, queue and thread.
+ *
+ * Install it with LogWriter::setLogger(). The LogWriter thread only puts
+ * messages into the queues of the sinks whose mask contains the message
+ * level, moving each into the last such sink and copying it for the
+ * others; every sink writes on its own thread, so a slow sink such as the
+ * console does not hold up a fast one. By default a sink queue drops new
+ * messages while it is full rather than blocking the LogWriter thread.
+ *
+ * The runtime level of LogWriter::setLevel() is applied before any sink
+ * sees a message, it has to admit the lowest level any sink wants.
+ *
+ * @code
+ * auto sinks = std::make_unique<FanOutLogger>();
+ * sinks->addSink(std::make_unique<ConsoleLogger>(),
+ *                levelMaskUpTo(Priority::PriorityLevel::eWarning));
+ * sinks->addSink(std::make_unique<FileLogger>("app.log"),
+ *                levelMaskUpTo(Priority::PriorityLevel::eDebug));
+ * LogWriter::setLogger(std::move(sinks));
+ * @endcode
+ */
+class FanOutLogger : public GenericLogger
+{
+  public:
+    static constexpr size_t cDefaultQueueCapacity = 8192;
+
+    FanOutLogger();
+
+    // Disable copy constructor and assignment operator
+    FanOutLogger(const FanOutLogger&)            = delete;
+    FanOutLogger& operator=(const FanOutLogger&) = delete;
+
+    /**
+     * @brief Adds a sink and starts its thread. Must not be called while
+     * messages are being written, i.e. before LogWriter::setLogger().
+     * @param logger Logger of the sink.
+     * @param levelMask Priority::PriorityLevel bits the sink accepts.
+     * @param queue Queue between the LogWriter thread and the sink, nullptr
+     * for a RingQueue of cDefaultQueueCapacity dropping new messages when
+     * full.
+     * @return Index of the sink.
+     */
+    size_t addSink(std::unique_ptr<ILogger> logger,
+                   Uint32                   levelMask,
+                   std::unique_ptr<IQueue>  queue = nullptr);
+
+    /**
+     * @brief Changes the level mask of a sink, takes effect for the next
+     * message.
+     * @param index Index returned by addSink().
+     * @param levelMask Priority::PriorityLevel bits the sink accepts.
+     */
+    void setLevelMask(size_t index, Uint32 levelMask);
+
+    /**
+     * @brief Number of sinks.
+     */
+    size_t getSinkCount() const;
+
+    /**
+     * @brief Number of messages the queue of a sink discarded because it was
+     * full.
+     * @param index Index returned by addSink().
+     */
+    Uint64 getDroppedCount(size_t index) const;
+
+    void write(const Message& msg) override;
+
+    /**
+     * @brief Like write(const Message&), moving the message into the queue
+     * of the last sink that accepts it instead of copying it.
+     * @param msg Message to write.
+     */
+    void write(Message&& msg);
+
+    void writeBatch(const std::vector<Message>& msgs) override;
+    void consumeBatch(std::vector<Message>& msgs) override;
+
+    /**
+     * @brief Waits until every sink has written its queued messages, then
+     * flushes the sink loggers.
+     */
+    void   flush() override;
+    String getLoggerType() const override;
+
+    /**
+     * @brief Sum of the bytes written by the sink loggers.
+     */
+    Uint64 getBytesWritten() const override;
+
+    /**
+     * @brief Writes out the queued messages and stops the sink threads.
+     */
+    ~FanOutLogger() override;
+
+  private:
+    struct Sink
+    {
+        Sink(std::unique_ptr<ILogger> logger,
+             Uint32                   levelMask,
+             std::unique_ptr<IQueue>  queue);
+
+        std::unique_ptr<ILogger> m_logger;    ///< Output of the sink
+        std::atomic<Uint32>      m_levelMask; ///< Accepted level bits
+        std::unique_ptr<IQueue>  m_queue;     ///< Filled by writeBatch()
+        std::thread              m_thread;    ///< Runs sinkThread()
+        std::atomic<bool>        m_running;   ///< Cleared by the destructor
+        std::atomic<bool>        m_parked;    ///< Sleeping on m_wakeCv
+        std::atomic<Uint64>      m_flushRequests; ///< Number of flushes asked
+        std::atomic<Uint64>      m_flushesDone;   ///< Flush requests served
+        std::mutex               m_mutex;         ///< Guards the cvs
+        std::condition_variable  m_wakeCv;        ///< Wakes the sink thread
+        std::condition_variable  m_flushCv;       ///< Wakes flush() callers
+    };
+
+    /**
+     * @brief Body of the thread of one sink.
+     */
+    static void sinkThread(Sink& sink);
+
+    /**
+     * @brief Wakes the thread of a sink if it is parked.
+     */
+    static void notify(Sink& sink);
+
+    /**
+     * @brief Checks the level of a message against the mask of a sink.
+     */
+    static bool accepts(const Sink& sink, const Message& msg);
+
+    /**
+     * @brief Queues a batch to the sinks, moving from the messages unless
+     * Batch is const.
+     */
+    template<typename Batch>
+    void dispatch(Batch& msgs);
+
+    std::vector<std::unique_ptr<Sink>> m_sinks; ///< Sinks in addSink() order
+};
+} // namespace Au::Logger
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+#include "Au/Types.hh"
+
+namespace Au::Logger {
+
+/**
+ * @enum ArgType
+ * @brief Tag stored in front of every argument of a deferred message.
+ */
+enum class ArgType : Uint8
+{
+    eInt64   = 1,
+    eUint64  = 2,
+    eDouble  = 3,
+    eString  = 4,
+    ePointer = 5,
+};
+
+/**
+ * @class FormatRegistry
+ * @brief Assigns small integer ids to printf-style format strings.
+ *
+ * Deferred messages carry only the id of their format string, the text is
+ * produced later by the logging thread or by an offline decoder. Id 0 is
+ * reserved for "%s", which is how plain text messages are represented.
+ */
+class FormatRegistry
+{
+  private:
+    std::mutex         m_mutex;   ///< Guards m_formats and m_interned
+    std::deque<String> m_formats; ///< Indexed by id, references stay valid
+    std::unordered_map<String, Uint32> m_interned; ///< internFormat() ids
+
+    FormatRegistry();
+
+  public:
+    static constexpr Uint32 cPlainTextId = 0;
+    static constexpr Uint32 cNoFormatId  = ~0u; ///< internFormat() is full
+    static constexpr size_t cMaxInterned = 4096; ///< internFormat() texts
+
+    FormatRegistry(const FormatRegistry&)            = delete;
+    FormatRegistry& operator=(const FormatRegistry&) = delete;
+
+    /**
+     * @brief Returns the process wide registry.
+     * @return Reference to the registry.
+     */
+    static FormatRegistry& get();
+
+    /**
+     * @brief Registers a format string, meant to be called once per call site.
+     * @param format printf-style format string.
+     * @return Id of the format string.
+     */
+    Uint32 registerFormat(const char* format);
+
+    /**
+     * @brief Registers a format string once per distinct text, for callers
+     * that cannot keep the id per call site, e.g. the C API. Registered
+     * strings are never freed, so at most cMaxInterned distinct texts are
+     * taken; formats built at run time would otherwise grow the registry
+     * without bound.
+     * @param format printf-style format string.
+     * @return Id of the format string, the same for equal strings, or
+     * cNoFormatId for a new text once cMaxInterned have been registered.
+     */
+    Uint32 internFormat(const char* format);
+
+    /**
+     * @brief Looks up a format string.
+     * @param id Id returned by registerFormat().
+     * @return The format string, or an empty string for an unknown id.
+     */
+    const String& getFormat(Uint32 id);
+
+    /**
+     * @brief Looks up a format string without locking, for crash handlers.
+     * Best effort while other threads register formats.
+     * @param id Id returned by registerFormat().
+     * @return The format string, or nullptr for an unknown id.
+     */
+    const char* peekFormat(Uint32 id) const;
+
+    /**
+     * @brief Number of registered format strings.
+     * @return Count, including the reserved id 0.
+     */
+    Uint32 getCount();
+};
+
+namespace detail {
+    template<typename T>
+    struct AlwaysFalse : std::false_type
+    {};
+
+    // Buffer is String or MessageBuffer
+    template<typename Buffer>
+    void appendRaw(Buffer& buf, const void* data, size_t size)
+    {
+        buf.append(static_cast<const char*>(data), size);
+    }
+
+    template<typename Buffer>
+    void appendString(Buffer& buf, const char* str, size_t len)
+    {
+        Uint32 size = static_cast<Uint32>(len);
+        buf.push_back(static_cast<char>(ArgType::eString));
+        appendRaw(buf, &size, sizeof(size));
+        appendRaw(buf, str, size);
+    }
+
+    template<typename Buffer, typename T>
+    void encodeArg(Buffer& buf, const T& arg)
+    {
+        using U = std::decay_t<T>;
+        if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>) {
+            const char* str = arg;
+            if (str == nullptr) {
+                str = "(null)";
+            }
+            appendString(buf, str, std::strlen(str));
+        } else if constexpr (std::is_convertible_v<const U&, StringView>) {
+            StringView view(arg);
+            appendString(buf, view.data(), view.size());
+        } else if constexpr (std::is_floating_point_v<U>) {
+            double value = static_cast<double>(arg);
+            buf.push_back(static_cast<char>(ArgType::eDouble));
+            appendRaw(buf, &value, sizeof(value));
+        } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+            Int64 value = static_cast<Int64>(arg);
+            buf.push_back(static_cast<char>(ArgType::eInt64));
+            appendRaw(buf, &value, sizeof(value));
+        } else if constexpr (std::is_integral_v<U> || std::is_enum_v<U>) {
+            Uint64 value = static_cast<Uint64>(arg);
+            buf.push_back(static_cast<char>(ArgType::eUint64));
+            appendRaw(buf, &value, sizeof(value));
+        } else if constexpr (std::is_pointer_v<U>) {
+            Uint64 value =
+                static_cast<Uint64>(reinterpret_cast<std::uintptr_t>(arg));
+            buf.push_back(static_cast<char>(ArgType::ePointer));
+            appendRaw(buf, &value, sizeof(value));
+        } else {
+            static_assert(AlwaysFalse<U>::value,
+                          "Unsupported argument type for deferred logging");
+        }
+    }
+} // namespace detail
+
+/**
+ * @brief Appends the encoding of args to buf, see encodeArgs().
+ * @param buf  String or MessageBuffer receiving the bytes.
+ * @param args Arguments matching the conversions of the format string.
+ */
+template<typename Buffer, typename... Args>
+void
+encodeArgsTo(Buffer& buf, const Args&... args)
+{
+    (detail::encodeArg(buf, args), ...);
+}
+
+/**
+ * @brief Encodes arguments as tagged raw bytes without formatting them.
+ *
+ * Integers are widened to 64 bits, floating point values to double, strings
+ * are copied with a length prefix.
+ * @param args Arguments matching the conversions of the format string.
+ * @return Encoded argument bytes.
+ */
+template<typename... Args>
+String
+encodeArgs(const Args&... args)
+{
+    String buf;
+    encodeArgsTo(buf, args...);
+    return buf;
+}
+
+/**
+ * @brief Encodes C variadic arguments like encodeArgsTo(), reading each
+ * with the type its conversion in format and length modifier call for.
+ *
+ * Stops at a '*' width or precision or an unknown conversion, the
+ * remaining conversions are then shown verbatim by formatDeferred().
+ * @param buf    String or MessageBuffer receiving the bytes.
+ * @param format printf-style format string.
+ * @param args   Arguments matching the conversions of format.
+ */
+template<typename Buffer>
+void
+encodeVarArgs(Buffer& buf, const char* format, va_list args);
+
+/**
+ * @brief Produces the text of a deferred message.
+ *
+ * Walks the printf-style format and renders each conversion with the next
+ * encoded argument. Length modifiers in the format are ignored, the stored
+ * argument type decides. '*' widths and %n are not supported.
+ * @param format printf-style format string.
+ * @param args   Argument bytes produced by encodeArgs().
+ * @return Formatted text.
+ */
+String
+formatDeferred(const String& format, StringView args);
+
+/**
+ * @brief Reads one argument back from bytes produced by encodeArgs().
+ * @param args Encoded argument bytes.
+ * @param pos  Offset of the argument, advanced past it on success.
+ * @param type Receives the argument type, only the matching one of bits,
+ * real and str is filled in.
+ * @param bits Value of eInt64 (two's complement), eUint64 and ePointer.
+ * @param real Value of eDouble.
+ * @param str  Value of eString, pointing into args.
+ * @return false at the end of args or if the bytes are malformed.
+ */
+bool
+decodeArg(StringView  args,
+          size_t&     pos,
+          ArgType&    type,
+          Uint64&     bits,
+          double&     real,
+          StringView& str);
+
+} // namespace Au::Logger
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -55,16 +55,32 @@ class LogManager
     explicit LogManager(std::shared_ptr<LogWriter> logWriter);
 
     /**
-     * @brief Appends a single message to the thread-local storage.
+     * @brief Appends a copy of a single message to the thread-local storage.
      * @param msg The message to log.
      */
     void log(Message& msg);
 
     /**
-     * @brief Flushes the thread-local messages to the LogWriter.
+     * @brief Moves a single message into the thread-local storage.
+     * @param msg The message to log.
+     */
+    void log(Message&& msg);
+
+    /**
+     * @brief Moves the thread-local messages to the LogWriter. The storage
+     * keeps its capacity, so steady state logging does not allocate here.
      */
     void flush();
 
+    /**
+     * @brief Calls visitor for the messages of every thread that have not
+     * been flushed to the LogWriter yet. Lock and allocation free, best
+     * effort like IQueue::visitPending().
+     * @param visitor Called once per message.
+     * @param ctx     Passed to visitor.
+     */
+    static void visitPending(MessageVisitor visitor, void* ctx);
+
     /**
      * @brief Destructor for LogManager.
      */
@@ -78,6 +94,14 @@ class LogManager
      */
     LogManager& operator<<(const Message& msg);
 
+    /**
+     * @brief Operator << moves a single Message into the current thread's
+     * buffer.
+     * @param msg The message to log.
+     * @return Reference to this LogManager.
+     */
+    LogManager& operator<<(Message&& msg);
+
     /**
      * @brief Operator << appends a string as a Message to the current thread's
      * buffer.
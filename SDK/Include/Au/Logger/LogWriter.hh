@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -30,8 +30,52 @@
 #include "Au/Logger/Logger.hh"
 #include "Au/Logger/Queue.hh"
 
+#include <condition_variable>
+
 namespace Au::Logger {
 
+/**
+ * @enum WakeupMode
+ * @brief How the logging thread waits for new messages.
+ */
+enum class WakeupMode
+{
+    eBusySpin,     ///< Poll the queue continuously, occupies a full core
+    eSpinThenPark, ///< Spin briefly, then sleep until a producer wakes it
+};
+
+/**
+ * @enum WriterPlacement
+ * @brief Where the logging thread runs, see LogWriter::setPlacement().
+ */
+enum class WriterPlacement
+{
+    eFloating,    ///< Left to the scheduler
+    eCpu,         ///< A given CPU, such as a dedicated housekeeping core
+    eLastSibling, ///< The last SMT sibling of the last physical core
+    eNearProducer ///< Another CPU of the NUMA node of the caller
+};
+
+/**
+ * @struct LogWriterStats
+ * @brief Counters of the logging pipeline, see LogWriter::getStats(). Counts
+ * accumulate over the life of the process.
+ */
+struct LogWriterStats
+{
+    Uint64 messagesWritten;     ///< Messages handed to the logger
+    Uint64 messagesDropped;     ///< Messages discarded by a full queue
+    Uint64 bytesWritten;        ///< Bytes the logger reported writing
+    Uint64 queueDepth;          ///< Messages queued, 0 once drained
+    Uint64 maxQueueDepth;       ///< Highest queueDepth seen
+    Uint64 enqueueSamples;      ///< Sampled log() calls
+    Uint64 enqueueLatencyAvgNs; ///< Mean time to queue a message
+    Uint64 enqueueLatencyMaxNs; ///< Longest time to queue a message
+    Uint64 writerBusyNs;        ///< Time the thread spent writing
+    Uint64 writerRunNs;         ///< Time the thread was running
+    double writerUtilization;   ///< writerBusyNs / writerRunNs
+};
+
 /**
  * @class LogWriter
  * @brief Manages the logging thread and writes messages through a chosen
@@ -43,9 +87,75 @@ class LogWriter
     std::thread              m_thread; ///< Thread for logging
     std::unique_ptr<ILogger> m_logger; ///< Logger instance
     std::atomic<bool> m_running; ///< Atomic boolean to control running state
-    LockingQueue      m_queue;   ///< Queue for log messages
+    std::unique_ptr<IQueue> m_queue; ///< Queue for log messages
+    std::atomic<WakeupMode> m_wakeupMode; ///< Waiting strategy of the thread
+    std::atomic<Uint64>     m_flushIntervalMs; ///< Max delay before flush
+    std::atomic<Uint32>     m_spinLimit; ///< Adaptive spin count before park
+    std::atomic<size_t>     m_batchSize; ///< Max messages per logger write
+    std::atomic<Uint64>     m_maxBatchDelayUs; ///< Max wait to fill a batch
+    std::atomic<bool>       m_parked;    ///< Thread is sleeping on m_wakeCv
+    std::atomic<bool>       m_idle;      ///< Thread found the queue empty
+    std::atomic<Uint64>     m_flushRequests; ///< Number of flush() calls
+    std::atomic<Uint64>     m_flushesDone;   ///< Flush requests served
+    std::mutex              m_wakeMutex; ///< Guards m_wakeCv and m_drainCv
+    std::condition_variable m_wakeCv;    ///< Wakes the parked thread
+    std::condition_variable m_drainCv;   ///< Wakes callers of drain()
+    std::atomic<bool>       m_coalesce;  ///< Collapse repeated messages
+    // Repeat tracking, used by the logging thread only
+    Message              m_last;       ///< Last message written
+    bool                 m_hasLast;    ///< m_last is valid
+    Uint64               m_repeats;    ///< Copies of m_last not written
+    std::chrono::steady_clock::time_point m_repeatsSince; ///< First repeat
+    std::vector<Message> m_coalesced; ///< Batch after collapsing repeats
+    std::atomic<int>     m_writerCpu; ///< CPU for the thread, -1 if none
+    std::atomic<Uint32>  m_placements; ///< Number of placement changes
     static std::mutex instanceMutex; ///< Mutex for singleton instance
     static std::shared_ptr<LogWriter> instance; ///< Singleton instance
+    static std::atomic<Uint64> generation; ///< Changes with instance
+    static std::atomic<Uint32> level; ///< Lowest PriorityLevel accepted
+    static std::atomic<Uint32> rateLimit; ///< Calls per second and site
+
+    /**
+     * @brief Counters behind getStats(). The writer side is only written by
+     * the logging thread, the enqueue side by sampled producers.
+     */
+    struct Counters
+    {
+        std::atomic<Uint64> messagesWritten;
+        std::atomic<Uint64> messagesDropped;
+        std::atomic<Uint64> bytesWritten;
+        std::atomic<Uint64> queueDepth;
+        std::atomic<Uint64> maxQueueDepth;
+        std::atomic<Uint64> writerBusyNs;
+        std::atomic<Uint64> writerRunNs;
+
+        alignas(64) std::atomic<Uint64> enqueueSamples;
+        std::atomic<Uint64> enqueueTotalNs;
+        std::atomic<Uint64> enqueueMaxNs;
+    };
+    static Counters counters;
+
+    // Counts last seen, used by the logging thread only
+    Uint64 m_loggerBytes;  ///< getBytesWritten() of m_logger
+    Uint64 m_queueDropped; ///< getDroppedCount() of m_queue
+
+    /**
+     * @brief Accounts the time since the previous call to the thread, and to
+     * its busy time if it was writing. Called by the logging thread.
+     * @param since Time of the previous call.
+     * @param busy Whether the thread was writing since then.
+     * @return The current time.
+     */
+    std::chrono::steady_clock::time_point tick(
+        std::chrono::steady_clock::time_point since, bool busy);
+
+    /**
+     * @brief Records the time a sampled log() call took.
+     * @param elapsed Duration of the call.
+     * @param count Messages queued by the call.
+     */
+    static void recordEnqueue(std::chrono::steady_clock::duration elapsed,
+                              size_t                              count);
 
     /**
      * @brief Main function executed by the logging thread to process queued
@@ -53,6 +163,68 @@ class LogWriter
      */
     void loggerThread();
 
+    /**
+     * @brief Waits for the queue to become non-empty according to the
+     * wakeup mode.
+     * @param dirty Whether messages were written since the last flush.
+     */
+    void waitForMessages(bool dirty);
+
+    /**
+     * @brief Moves up to the batch size worth of messages from the queue into
+     * batch, waiting at most the maximum batch delay for it to fill up.
+     * @param batch Receives the messages, expected to be empty.
+     */
+    void fillBatch(std::vector<Message>& batch);
+
+    /**
+     * @brief Hands a batch to the logger, collapsing repeated messages
+     * first if enabled.
+     * @param batch Messages to write, left empty.
+     */
+    void writeBatch(std::vector<Message>& batch);
+
+    /**
+     * @brief Writes the "repeated" message for copies of the last message
+     * that were held back, if any.
+     */
+    void reportRepeats();
+
+    /**
+     * @brief Marks the logging thread idle and releases drain() callers.
+     */
+    void markIdle();
+
+    /**
+     * @brief Flushes the logger on the logging thread and releases flush()
+     * callers.
+     * @param flushRequests Flush requests seen before the queue was found
+     * empty.
+     */
+    void serveFlush(Uint64 flushRequests);
+
+    /**
+     * @brief Writes out pending messages and joins the logging thread.
+     */
+    void stopThread();
+
+    /**
+     * @brief Creates the singleton instance, instanceMutex must be held.
+     */
+    static void createInstance();
+
+    /**
+     * @brief Pins the logging thread to m_writerCpu, if set. Called by the
+     * logging thread.
+     * @return The m_placements count it applied.
+     */
+    Uint32 applyPlacement();
+
+    /**
+     * @brief Wakes the logging thread if it is parked.
+     */
+    void notify();
+
     /**
      * @brief Private constructor for singleton pattern.
      */
@@ -68,32 +240,237 @@ class LogWriter
     ~LogWriter();
 
     /**
-     * @brief Retrieves the singleton instance of LogWriter, creating it if
-     * necessary.
+     * @brief Retrieves the singleton instance of LogWriter, creating it and
+     * starting the logging thread if necessary.
+     *
+     * The thread keeps running until stop() or shutdown() is called, or the
+     * process exits.
      * @return A shared pointer to the unique LogWriter instance.
      */
     static std::shared_ptr<LogWriter> getLogWriter();
 
+    /**
+     * @brief Returns the running LogWriter like getLogWriter(), for the
+     * logging hot path. Each thread keeps its own reference and only takes
+     * instanceMutex when the instance has been created, shut down or
+     * replaced since, so producers do not serialize or share a reference
+     * count.
+     * @return The running LogWriter instance.
+     */
+    static LogWriter& current();
+
+    /**
+     * @brief Stops the logging thread after writing out pending messages and
+     * destroys the singleton instance. Called automatically at process exit.
+     */
+    static void shutdown();
+
     /**
      * @brief Specifies the ILogger implementation to use for output.
+     *
+     * Pending messages are written to the previous logger first.
      * @param logger A unique pointer to an ILogger-derived object.
      */
     static void setLogger(std::unique_ptr<ILogger> logger);
 
+    /**
+     * @brief Specifies the IQueue implementation between producers and the
+     * logging thread, e.g. a RingQueue or LockingQueue instead of the default
+     * PerThreadQueue.
+     *
+     * Pending messages are written out before the queue is replaced. Must not
+     * be called while other threads are logging.
+     * @param queue A unique pointer to an IQueue-derived object.
+     */
+    static void setQueue(std::unique_ptr<IQueue> queue);
+
+    /**
+     * @brief Sets the lowest priority the AU_LOGGER_LOG* macros let through.
+     * Lower priority calls return before evaluating their arguments.
+     *
+     * Applies on top of the compile time AU_LOGGER_MIN_LEVEL. The default,
+     * eTrace, lets everything through.
+     * @param minLevel Lowest enabled priority level.
+     */
+    static void setLevel(Priority::PriorityLevel minLevel);
+
+    /**
+     * @brief Gets the lowest priority set with setLevel().
+     * @return Lowest enabled priority level.
+     */
+    static Priority::PriorityLevel getLevel();
+
+    /**
+     * @brief Checks a priority level against the runtime level, cheap enough
+     * to guard every log statement.
+     * @param msgLevel Priority level of the message.
+     * @return true if messages of this level should be logged.
+     */
+    static bool isLevelEnabled(Priority::PriorityLevel msgLevel)
+    {
+        // Higher priority levels have lower values
+        return static_cast<Uint32>(msgLevel)
+               <= level.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Limits how often each AU_LOGGER_LOG* call site may log, calls
+     * beyond the limit return without logging. The next message a call site
+     * logs carries the number of calls it dropped as field "suppressed".
+     * @param perSecond Calls per second and call site, 0 (the default) for
+     * no limit.
+     */
+    static void setRateLimit(Uint32 perSecond);
+
+    /**
+     * @brief Gets the limit set with setRateLimit(), cheap enough for every
+     * log statement.
+     * @return Calls per second and call site, 0 for no limit.
+     */
+    static Uint32 getRateLimit()
+    {
+        return rateLimit.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Starts the dedicated logging thread.
      */
     void start();
 
     /**
-     * @brief Signals the logging thread to stop and waits for it to finish.
+     * @brief Signals the logging thread to stop, waits for it to finish and
+     * destroys the singleton instance.
      */
     void stop();
 
+    /**
+     * @brief Blocks until every message queued so far has been written and
+     * the logger flushed. The logging thread keeps running.
+     */
+    void flush();
+
+    /**
+     * @brief Blocks until every message queued so far has been handed to the
+     * logger. Returns immediately if the queue is already empty.
+     */
+    void drain();
+
+    /**
+     * @brief Selects how the logging thread waits for messages.
+     *
+     * The default, WakeupMode::eSpinThenPark, spins for an adaptively sized
+     * number of iterations and then sleeps until a producer wakes it.
+     * @param mode Wakeup mode.
+     */
+    void setWakeupMode(WakeupMode mode);
+
+    /**
+     * @brief Bounds the time between writing a message and flushing the
+     * logger. Zero (the default) flushes only on stop().
+     * @param interval Maximum flush latency.
+     */
+    void setFlushInterval(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Sets how many messages the logging thread takes from the queue
+     * per wakeup and hands to the logger in one ILogger::writeBatch() call.
+     * @param batchSize Maximum messages per batch, at least 1.
+     */
+    void setBatchSize(size_t batchSize);
+
+    /**
+     * @brief Sets how long the logging thread may wait for a partial batch to
+     * fill up before writing it. Zero (the default) writes whatever is queued
+     * right away.
+     * @param delay Maximum batch delay.
+     */
+    void setMaxBatchDelay(std::chrono::microseconds delay);
+
+    /**
+     * @brief Collapses runs of identical messages, same priority, text and
+     * fields, into the first one followed by "Last message repeated K
+     * times". The count is written when a different message arrives, on
+     * flush, on stop and at least once per second while the run goes on.
+     * Off by default.
+     * @param enable Whether to collapse repeated messages.
+     */
+    void setCoalesceRepeats(bool enable);
+
+    /**
+     * @brief Pins the logging thread through the thread pinning topology, so
+     * that it does not compete with pinned compute threads or pull buffers
+     * across sockets. The CPU is chosen when this is called and kept across
+     * restarts of the thread, eNearProducer picks it next to the calling
+     * thread.
+     *
+     * The environment variable AU_LOGGER_WRITER_CPU sets the initial
+     * placement: a CPU number, "last-sibling" or "near-producer". By default
+     * the thread floats; going back to eFloating takes effect when the
+     * thread is next started.
+     * @param placement Placement strategy.
+     * @param cpu CPU for WriterPlacement::eCpu, ignored otherwise.
+     * @return The chosen CPU, or -1 if the thread is left floating.
+     */
+    int setPlacement(WriterPlacement placement, int cpu = -1);
+
+    /**
+     * @brief CPU the logging thread is pinned to.
+     * @return CPU number, or -1 if the thread floats or could not be pinned.
+     */
+    int getPlacementCpu() const;
+
     /**
      * @brief Sends a batch of messages to the logging queue.
-     * @param msgs A vector of log messages to enqueue.
+     * @param msgs A vector of log messages to enqueue, the messages are moved
+     * out of it.
      */
     void log(std::vector<Message>& msgs);
+
+    /**
+     * @brief Sends a single message to the logging queue.
+     * @param msg The log message, moved from.
+     */
+    void log(Message&& msg);
+
+    /**
+     * @brief Number of messages the queue discarded because it was full.
+     * @return Dropped message count.
+     */
+    Uint64 getDroppedCount() const;
+
+    /**
+     * @brief Calls visitor for the messages not written yet: those in the
+     * queue, then those in the LogManager storage of each thread. Lock and
+     * allocation free, best effort, see IQueue::visitPending().
+     * @param visitor Called once per message.
+     * @param ctx     Passed to visitor.
+     */
+    static void visitPending(MessageVisitor visitor, void* ctx);
+
+    /**
+     * @brief Installs handlers for SIGSEGV, SIGABRT, SIGBUS, SIGFPE and
+     * SIGILL that write the messages not written yet to fd, then pass the
+     * signal on to the handler that was installed before. Off by default,
+     * POSIX only.
+     *
+     * The handler only uses write(2) and stack memory. Deferred messages are
+     * rendered with a reduced formatter that ignores widths and precisions,
+     * and timestamps are printed as seconds since the epoch. Messages the
+     * logging thread has already taken, and output buffered by the logger,
+     * are not included.
+     * @param enable Install or remove the handlers.
+     * @param fd     Descriptor to write to, standard error by default.
+     */
+    static void setCrashFlush(bool enable, int fd = 2);
+
+    /**
+     * @brief Reads the pipeline counters without locking, cheap enough to be
+     * scraped periodically while other threads log.
+     *
+     * Queue depth, drops and bytes are updated by the logging thread once
+     * per batch. Enqueue latency is measured on a sample of the log() calls.
+     * @return Snapshot of the counters.
+     */
+    static LogWriterStats getStats();
 };
 } // namespace Au::Logger
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -29,6 +29,12 @@
 #pragma once
 #include "Au/Logger/Message.hh"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+
 /**
  * @brief ISink class - Writes the message to the output
  */
@@ -49,6 +55,29 @@ class ILogger
      */
     virtual void write(const Message& msg) = 0;
 
+    /**
+     * @brief Writes a batch of log messages to the output, in order.
+     *
+     * Implementations should format the whole batch into one buffer and hand
+     * it to the output in a single call. The default calls write() for every
+     * message.
+     * @param msgs The log messages.
+     */
+    virtual void writeBatch(const std::vector<Message>& msgs)
+    {
+        for (const auto& msg : msgs) {
+            write(msg);
+        }
+    }
+
+    /**
+     * @brief Writes a batch the caller discards afterwards, so the messages
+     * may be moved from. The LogWriter thread writes through this; the
+     * default calls writeBatch().
+     * @param msgs The log messages, valid but unspecified afterwards.
+     */
+    virtual void consumeBatch(std::vector<Message>& msgs) { writeBatch(msgs); }
+
     /**
      * @brief Flush the output.
      */
@@ -72,6 +101,13 @@ class ILogger
      */
     virtual String getLoggerType() const = 0;
 
+    /**
+     * @brief Bytes handed to the output so far, safe to call from any
+     * thread.
+     * @return Bytes written, 0 if the logger does not count them.
+     */
+    virtual Uint64 getBytesWritten() const { return 0; }
+
     virtual ~ILogger() = default;
 };
 
@@ -82,7 +118,20 @@ class ILogger
 class GenericLogger : public ILogger
 {
   protected:
-    String m_loggerName{}; ///< Logger name
+    String              m_loggerName{};     ///< Logger name
+    std::atomic<Uint64> m_bytesWritten{ 0 }; ///< Bytes handed to the output
+
+    /**
+     * @brief Adds to the count returned by getBytesWritten(), called by the
+     * thread writing.
+     * @param bytes Bytes just written.
+     */
+    void countBytes(size_t bytes)
+    {
+        m_bytesWritten.store(m_bytesWritten.load(std::memory_order_relaxed)
+                                 + bytes,
+                             std::memory_order_relaxed);
+    }
 
   public:
     virtual void   write(const Message& msg) override;
@@ -90,6 +139,7 @@ class GenericLogger : public ILogger
     virtual String getLoggerName() const override;
     virtual String getLoggerType() const override;
     virtual void   flush() override;
+    virtual Uint64 getBytesWritten() const override;
     virtual ~GenericLogger() override = default;
 };
 
@@ -99,8 +149,12 @@ class GenericLogger : public ILogger
  */
 class ConsoleLogger : public GenericLogger
 {
+  private:
+    String m_buffer{}; ///< Reused to format a batch
+
   public:
     void   write(const Message& msg) override;
+    void   writeBatch(const std::vector<Message>& msgs) override;
     String getLoggerType() const override;
     void   flush() override;
     ~ConsoleLogger() override = default;
@@ -125,9 +179,23 @@ class DummyLogger : public GenericLogger
  */
 class FileLogger : public GenericLogger
 {
-  private:
+  protected:
     String m_filename; ///< Filename to write logs
     FILE*  m_file;     ///< File pointer
+    String m_buffer;   ///< Reused to format a batch
+
+    /**
+     * @brief Writes the whole buffer to the file with as few system calls as
+     * possible, normally one.
+     */
+    void writeBuffer();
+
+    /**
+     * @brief Constructor for derived loggers writing in another mode.
+     * @param filename The file to which logs should be written.
+     * @param mode fopen() mode.
+     */
+    FileLogger(const String& filename, const char* mode);
 
   public:
     /**
@@ -141,12 +209,313 @@ class FileLogger : public GenericLogger
     FileLogger& operator=(const FileLogger&) = delete;
 
     void   write(const Message& msg) override;
+    void   writeBatch(const std::vector<Message>& msgs) override;
     void   flush() override;
     String getLoggerType() const override;
 
     ~FileLogger() override;
 };
 
+/**
+ * @class JsonFileLogger
+ * @brief Writes log messages to a file as JSON lines, one object per message.
+ *
+ * Every line has the members "ts" (nanoseconds since the epoch), "level",
+ * "msg" and, if the message has structured fields, "fields" holding them as
+ * an object with their original types. Doubles that are not finite are
+ * written as null. All formatting happens on the logging thread.
+ */
+class JsonFileLogger : public FileLogger
+{
+  private:
+    std::vector<Field> m_fields; ///< Reused to decode the fields
+
+    /**
+     * @brief Appends the JSON line of one message to m_buffer.
+     */
+    void appendRecord(const Message& msg);
+
+  public:
+    /**
+     * @brief Constructor for JsonFileLogger.
+     * @param filename The file to which lines should be appended.
+     */
+    explicit JsonFileLogger(const String& filename);
+
+    void   write(const Message& msg) override;
+    void   writeBatch(const std::vector<Message>& msgs) override;
+    String getLoggerType() const override;
+};
+
+/**
+ * @struct RotationPolicy
+ * @brief When a RotatingFileLogger starts a new file and how many old files
+ * it keeps.
+ */
+struct RotationPolicy
+{
+    /// Rotate once the file would grow beyond this many bytes, 0 disables
+    Uint64 maxFileSize = 16 * 1024 * 1024;
+    /// Rotate once the file has been open for this long, 0 disables
+    std::chrono::seconds maxFileAge{ 0 };
+    /// Rotated files kept, older ones are deleted; 0 keeps all of them
+    Uint32 maxFiles = 5;
+    /// Reserve maxFileSize bytes of disk for every new file (Linux only)
+    bool preallocate = true;
+    /// Runs on the housekeeping thread for every rotated file before old
+    /// files are deleted, e.g. to compress it
+    std::function<void(const String& rotatedFile)> onRotated{};
+};
+
+/**
+ * @class RotatingFileLogger
+ * @brief Writes log messages to a file that is rotated by size or age.
+ *
+ * The file is written with write(2) directly, without stdio buffering or
+ * locking. On rotation the active file is renamed to "<filename>.<n>", with
+ * n counting up, and a new file is opened. Deleting files beyond
+ * RotationPolicy::maxFiles and running RotationPolicy::onRotated happen on a
+ * separate housekeeping thread, so the logging thread never waits for them.
+ */
+class RotatingFileLogger : public GenericLogger
+{
+  private:
+    String         m_filename; ///< Active log file
+    RotationPolicy m_policy;   ///< Rotation settings
+    int            m_fd;       ///< Descriptor of the active file
+    Uint64         m_size;     ///< Bytes in the active file
+    Uint64         m_sequence; ///< Number of the newest rotated file
+    std::chrono::steady_clock::time_point m_openedAt; ///< For maxFileAge
+    String                                m_buffer; ///< Reused for a batch
+
+    std::thread             m_housekeeper; ///< Runs housekeeping()
+    std::mutex              m_mutex;       ///< Guards the members below
+    std::condition_variable m_cv;          ///< Signals new rotated files
+    std::deque<std::pair<Uint64, String>> m_rotated; ///< Waiting for cleanup
+    bool                                  m_busy;    ///< Cleanup in progress
+    bool                                  m_stopping; ///< Destructor called
+
+    /**
+     * @brief Opens (or creates) the active file and reserves its space.
+     */
+    void openFile();
+
+    /**
+     * @brief Renames the active file, opens a new one and queues the old one
+     * for housekeeping.
+     */
+    void rotate();
+
+    /**
+     * @brief Writes m_buffer to the active file and empties it.
+     */
+    void writeBuffer();
+
+    /**
+     * @brief Checks whether the active file is due for rotation before the
+     * next message is added.
+     * @param pending Bytes formatted for the active file but not written.
+     * @param bytes   Length of the next message.
+     */
+    bool needsRotation(size_t pending, size_t bytes) const;
+
+    /**
+     * @brief Formats a message into m_buffer, first writing out and rotating
+     * the file if the message does not fit.
+     */
+    void appendLine(const Message& msg);
+
+    /**
+     * @brief Body of the housekeeping thread.
+     */
+    void housekeeping();
+
+    /**
+     * @brief Deletes rotated files older than the retention allows.
+     * @param newest Number of the newest rotated file.
+     */
+    void removeExpired(Uint64 newest);
+
+  public:
+    /**
+     * @brief Constructor for RotatingFileLogger.
+     * @param filename The file to which logs should be written.
+     * @param policy When to rotate and how many files to keep.
+     */
+    explicit RotatingFileLogger(const String&         filename,
+                                const RotationPolicy& policy = RotationPolicy());
+
+    // Disable copy constructor and assignment operator
+    RotatingFileLogger(const RotatingFileLogger&)            = delete;
+    RotatingFileLogger& operator=(const RotatingFileLogger&) = delete;
+
+    void   write(const Message& msg) override;
+    void   writeBatch(const std::vector<Message>& msgs) override;
+    void   flush() override;
+    String getLoggerType() const override;
+
+    /**
+     * @brief Blocks until the housekeeping thread has handled every rotated
+     * file.
+     */
+    void waitForHousekeeping();
+
+    ~RotatingFileLogger() override;
+};
+
+/**
+ * @class MappedFileLogger
+ * @brief Writes log messages into a memory-mapped file used as a ring buffer,
+ * a flight recorder for post-mortem inspection.
+ *
+ * The file has a fixed size, a cHeaderSize byte header followed by capacity
+ * bytes of text lines. Appending a batch is a memory copy plus a store of the
+ * write position, there are no system calls. Once the ring is full the
+ * oldest lines are overwritten. The pages belong to the kernel page cache, so
+ * the newest capacity bytes survive a crash of the process (not of the
+ * machine). Reopening a file of the same capacity continues the ring.
+ *
+ * Header layout, host byte order:
+ * - cMagic (8 bytes).
+ * - Uint64 capacity of the data area.
+ * - Uint64 write position, bytes ever written; the data area holds the bytes
+ *   before it modulo capacity.
+ *
+ * Use dump(), or the au_logdecode tool, to read the lines back oldest first.
+ * Only available on POSIX systems, elsewhere the logger reports an error and
+ * drops messages.
+ */
+class MappedFileLogger : public GenericLogger
+{
+  private:
+    String m_filename; ///< Mapped file
+    Uint64 m_capacity; ///< Bytes in the data area
+    Uint64 m_position; ///< Bytes ever written, mirrored in the header
+    char*  m_map;      ///< Start of the mapping, the header
+    char*  m_data;     ///< Start of the data area, nullptr if not mapped
+    String m_buffer;   ///< Reused to format a batch
+
+    /**
+     * @brief Creates or reuses the file and maps it.
+     */
+    void mapFile();
+
+    /**
+     * @brief Copies m_buffer into the ring and publishes the new write
+     * position.
+     */
+    void writeBuffer();
+
+  public:
+    static constexpr char cMagic[8] = { 'A', 'U', 'L', 'O', 'G', 'M', '1', '\n' };
+    static constexpr Uint64 cHeaderSize      = 64;
+    static constexpr Uint64 cDefaultCapacity = 16 * 1024 * 1024;
+
+    /**
+     * @brief Constructor for MappedFileLogger.
+     * @param filename The file to map.
+     * @param capacity Bytes of log text kept, rounded up to whole pages.
+     */
+    explicit MappedFileLogger(const String& filename,
+                              Uint64        capacity = cDefaultCapacity);
+
+    // Disable copy constructor and assignment operator
+    MappedFileLogger(const MappedFileLogger&)            = delete;
+    MappedFileLogger& operator=(const MappedFileLogger&) = delete;
+
+    void   write(const Message& msg) override;
+    void   writeBatch(const std::vector<Message>& msgs) override;
+    void   flush() override;
+    String getLoggerType() const override;
+
+    /**
+     * @brief Capacity of the data area after rounding.
+     */
+    Uint64 getCapacity() const;
+
+    /**
+     * @brief Writes the lines kept in a mapped log file, oldest first. A line
+     * partly overwritten by the ring is skipped.
+     * @param filename File written by MappedFileLogger.
+     * @param out Stream receiving the text.
+     * @return false if the file cannot be read or is not a mapped log.
+     */
+    static bool dump(const String& filename, std::ostream& out);
+
+    ~MappedFileLogger() override;
+};
+
+/**
+ * @class BinaryFileLogger
+ * @brief Writes log messages to a file as compact binary records.
+ *
+ * Deferred messages are stored as their format string id plus the encoded
+ * arguments, so no text is formatted on the logging path at all. The format
+ * strings themselves are written once per file session. Use
+ * BinaryLogDecoder, or the au_logdecode tool, to turn the file into text.
+ *
+ * The file starts every session with cMagic followed by records. A record
+ * starts with a kind byte:
+ * - 'F': Uint32 format id, Uint32 length, format string bytes.
+ * - 'M': Uint32 format id, Uint32 priority level, Uint64 timestamp in
+ *        nanoseconds since the epoch, Uint32 length, encoded argument bytes.
+ * - 'K': Uint32 length, structured fields of the preceding 'M' record as
+ *        returned by Message::getEncodedFields().
+ *
+ * Plain text messages are stored with FormatRegistry::cPlainTextId. Values
+ * are in host byte order.
+ */
+class BinaryFileLogger : public FileLogger
+{
+  private:
+    std::vector<bool> m_formatWritten; ///< Format ids already in the file
+
+    /**
+     * @brief Appends the record of one message, preceded by its format
+     * definition if this session has not written it yet.
+     */
+    void appendRecord(const Message& msg);
+
+  public:
+    static constexpr char cMagic[8] = { 'A', 'U', 'L', 'O', 'G', 'B', '1', '\n' };
+
+    /**
+     * @brief Constructor for BinaryFileLogger.
+     * @param filename The file to which records should be appended.
+     */
+    explicit BinaryFileLogger(const String& filename);
+
+    void   write(const Message& msg) override;
+    void   writeBatch(const std::vector<Message>& msgs) override;
+    String getLoggerType() const override;
+};
+
+/**
+ * @class BinaryLogDecoder
+ * @brief Turns files written by BinaryFileLogger back into log messages.
+ */
+class BinaryLogDecoder
+{
+  public:
+    /**
+     * @brief Decodes a binary log.
+     * @param data Contents of the binary log file.
+     * @param msgs Receives the decoded messages, in file order.
+     * @return false if the data is not a binary log or is truncated; the
+     * messages decoded up to that point are still returned.
+     */
+    static bool decode(const String& data, std::vector<Message>& msgs);
+
+    /**
+     * @brief Decodes a binary log file into text, one message per line, in
+     * the same layout as FileLogger.
+     * @param filename Binary log file.
+     * @param out Stream receiving the text.
+     * @return false if the file cannot be read or is not a binary log.
+     */
+    static bool decodeFile(const String& filename, std::ostream& out);
+};
+
 /**
  * @class LoggerFactory
  * @brief Provides methods to create and configure logger instances.
@@ -155,6 +524,15 @@ class FileLogger : public GenericLogger
  * - "ConsoleLogger": Logs to console.
  * - "DummyLogger": Disables logging (no-op).
  * - "FileLogger": Logs to a file, specify filename as loggerName argument.
+ * - "BinaryFileLogger": Logs binary records to a file, specify filename as
+ *   loggerName argument.
+ * - "RotatingFileLogger": Logs to a file rotated with the default
+ *   RotationPolicy, specify filename as loggerName argument.
+ * - "JsonFileLogger": Logs JSON lines to a file, specify filename as
+ *   loggerName argument.
+ * - "MappedFileLogger": Logs to a memory-mapped ring buffer file of
+ *   MappedFileLogger::cDefaultCapacity bytes, specify filename as loggerName
+ *   argument.
  */
 class LoggerFactory
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -28,21 +28,105 @@
 
 #pragma once
 
+#include "Au/Config.h"
 #include "Au/Logger/LogManager.hh"
+#include "Au/Logger/RateLimiter.hh"
 
 using Au::Logger::LogManager;
 using Au::Logger::LogWriter;
 using Au::Logger::Message;
 using Au::Logger::Priority;
 
+/*
+ * Calls below AU_LOGGER_MIN_LEVEL (Au/Config.h, set through CMake) compile to
+ * nothing, the rest check LogWriter::isLevelEnabled() first. Either way the
+ * message arguments are only evaluated if the call is going to be logged.
+ *
+ * The logging thread is started by the first call and keeps running; use
+ * LogWriter::getLogWriter()->flush() to wait for the output, or
+ * LogWriter::shutdown() to stop it before process exit.
+ */
+#define AU_LOGGER_LEVEL_ENABLED(level)                                         \
+    (static_cast<Au::Uint32>(Priority::PriorityLevel::level)                   \
+     <= AU_LOGGER_MIN_LEVEL)
+
+#define AU_LOGGER_SUBMIT_(message, suppressed)                                 \
+    {                                                                          \
+        if (suppressed != 0) {                                                 \
+            message.addField("suppressed", suppressed);                        \
+        }                                                                      \
+        LogWriter::current().log(std::move(message));                          \
+    }
+
+/*
+ * Rate limited variant, logs at most perSecond calls per second from this
+ * call site (0 for no limit). The plain macros use the limit set with
+ * LogWriter::setRateLimit(), unlimited by default. A message logged after
+ * calls were dropped carries their number as field "suppressed".
+ */
+#define AU_LOGGER_LOG_RATE(msg, level, perSecond)                              \
+    {                                                                          \
+        if constexpr (AU_LOGGER_LEVEL_ENABLED(level)) {                        \
+            if (LogWriter::isLevelEnabled(Priority::PriorityLevel::level)) {   \
+                static Au::Logger::RateLimiter auRateLimiter;                  \
+                Au::Uint64                     auSuppressed = 0;               \
+                if (auRateLimiter.allow((perSecond), auSuppressed)) {          \
+                    Priority priority(Priority::PriorityLevel::level);         \
+                    Message  message(Au::StringView(msg), priority);           \
+                    AU_LOGGER_SUBMIT_(message, auSuppressed);                  \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+    }
+
 #define AU_LOGGER_LOG(msg, level)                                              \
+    AU_LOGGER_LOG_RATE(msg, level, LogWriter::getRateLimit())
+
+/*
+ * Deferred variant, fmt is a printf-style string literal. Only the argument
+ * values are captured here; the text is formatted by the logging thread, or
+ * never if a BinaryFileLogger is in use.
+ */
+#define AU_LOGGER_LOGF(level, fmt, ...)                                        \
+    {                                                                          \
+        if constexpr (AU_LOGGER_LEVEL_ENABLED(level)) {                        \
+            if (LogWriter::isLevelEnabled(Priority::PriorityLevel::level)) {   \
+                static Au::Logger::RateLimiter auRateLimiter;                  \
+                Au::Uint64                     auSuppressed = 0;               \
+                if (auRateLimiter.allow(LogWriter::getRateLimit(),             \
+                                        auSuppressed)) {                       \
+                    static const Au::Uint32 auFormatId =                       \
+                        Au::Logger::FormatRegistry::get().registerFormat(fmt); \
+                    Priority priority(Priority::PriorityLevel::level);         \
+                    Message  message = Message::deferred(                      \
+                        auFormatId, priority, ##__VA_ARGS__);                  \
+                    AU_LOGGER_SUBMIT_(message, auSuppressed);                  \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+    }
+
+/*
+ * Structured variant, the variadic arguments are key, value pairs stored as
+ * typed fields of the message, e.g.
+ * AU_LOGGER_LOG_FIELDS(eInfo, "Kernel done", "kernel", name, "m", m);
+ * They are only formatted by the logger, see JsonFileLogger.
+ */
+#define AU_LOGGER_LOG_FIELDS(level, msg, ...)                                  \
     {                                                                          \
-        Priority   priority(Priority::PriorityLevel::level);                   \
-        Message    message(std::string(msg), priority);                        \
-        LogManager logger = LogManager(LogWriter::getLogWriter());             \
-        logger << message;                                                     \
-        logger.flush();                                                        \
-        LogWriter::getLogWriter()->stop();                                     \
+        if constexpr (AU_LOGGER_LEVEL_ENABLED(level)) {                        \
+            if (LogWriter::isLevelEnabled(Priority::PriorityLevel::level)) {   \
+                static Au::Logger::RateLimiter auRateLimiter;                  \
+                Au::Uint64                     auSuppressed = 0;               \
+                if (auRateLimiter.allow(LogWriter::getRateLimit(),             \
+                                        auSuppressed)) {                       \
+                    Priority priority(Priority::PriorityLevel::level);         \
+                    Message  message(Au::StringView(msg), priority);           \
+                    message.addFields(__VA_ARGS__);                            \
+                    AU_LOGGER_SUBMIT_(message, auSuppressed);                  \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
     }
 
 #define AU_LOGGER_LOG_INFO(msg) AU_LOGGER_LOG(msg, eInfo)
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -36,6 +36,8 @@
 #include <thread>
 #include <vector>
 
+#include "Au/Logger/Format.hh"
+#include "Au/Logger/MessageBuffer.hh"
 #include "Au/Types.hh"
 
 using Au::String;
@@ -46,19 +48,50 @@ namespace Au::Logger {
  * @class Timestamp
  * @brief Represents a time point and provides convenience methods for
  * extracting time components.
+ *
+ * Capturing a timestamp is a single steady_clock read. It is converted to
+ * wall clock time only when asked for, using an offset that the logging
+ * thread refreshes once per batch, and the calendar text is cached per
+ * second and thread.
  */
 class Timestamp
 {
   private:
-    std::chrono::time_point<std::chrono::system_clock> m_now;
+    Int64 m_ticks; ///< steady_clock time in nanoseconds
 
   public:
     Timestamp();
+
+    /**
+     * @brief Constructs a timestamp from a raw value.
+     * @param nanoseconds Nanoseconds since the epoch, see getNanosecond().
+     */
+    explicit Timestamp(Uint64 nanoseconds);
+
+    /**
+     * @brief Re-reads the wall clock, so that timestamps follow adjustments
+     * of the system time. Called by the logging thread once per batch.
+     */
+    static void rebase();
+
+    /**
+     * @brief Raw captured value.
+     * @return steady_clock time in nanoseconds.
+     */
+    Int64 getTicks() const;
+
     /**
      * @brief Returns a formatted timestamp string.
-     * @return Timestamp in "HH:MM:SS.milli" format.
+     * @return Timestamp in "Mon Sep 02 2024 11:31:36" format.
      */
     String getTimestamp() const;
+
+    /**
+     * @brief Appends getTimestamp() to out without temporary strings.
+     * @param out String to append to.
+     */
+    void appendTimestamp(String& out) const;
+
     Uint64 getHour() const;
     Uint64 getMinute() const;
     Uint64 getSecond() const;
@@ -95,6 +128,12 @@ class Priority
 
     String toStr() const;
 
+    /**
+     * @brief Get the priority level.
+     * @return Priority level.
+     */
+    PriorityLevel getLevel() const;
+
     // Operator overloads to compare the priority
     bool operator<(const Priority& rhs) const;
     bool operator>(const Priority& rhs) const;
@@ -112,38 +151,186 @@ class Priority
     PriorityLevel m_level;
 };
 
+/**
+ * @struct Field
+ * @brief One structured key/value pair of a Message, as returned by
+ * Message::getFields().
+ */
+struct Field
+{
+    StringView key;  ///< Name of the field
+    ArgType    type; ///< Selects the member below holding the value
+    Uint64     bits; ///< eInt64 (two's complement), eUint64 or ePointer value
+    double     real; ///< eDouble value
+    StringView text; ///< eString value
+};
+
 // Class for message.
 /**
  * @class Message
  * @brief Encapsulates a log message with content, priority, and timestamp.
+ *
+ * The payload is a MessageBuffer, so a message of up to
+ * MessageBuffer::cInlineCapacity bytes is created and moved without touching
+ * the heap.
+ *
+ * Structured fields added with addField() are stored behind the text in the
+ * same buffer, encoded like deferred arguments, and only turned into text by
+ * the logger.
  */
 class Message
 {
   private:
-    String    m_msg;       ///< Log message
-    Priority  m_priority;  ///< Priority of the message
-    Timestamp m_timestamp; ///< Timestamp of the message
+    MessageBuffer m_msg;       ///< Log text, or encoded arguments if deferred
+    Priority      m_priority;  ///< Priority of the message
+    Uint32        m_formatId;  ///< Format string id if deferred
+    Uint32        m_fieldsAt;  ///< Offset of the fields in m_msg
+    Timestamp     m_timestamp; ///< Timestamp of the message
+
+    static constexpr size_t cLevelWidth = 7; ///< Priority column width
+
+    /**
+     * @brief Constructor for a deferred message.
+     * @param formatId Id from FormatRegistry.
+     * @param args     Arguments encoded with encodeArgs().
+     * @param priority Priority of the message.
+     */
+    Message(Uint32 formatId, MessageBuffer&& args, const Priority& priority);
 
   public:
+    static constexpr Uint32 cNotDeferred = UINT32_MAX;
+
+    /**
+     * @brief Creates a message whose text is formatted only when it is
+     * written, from a printf-style format string registered with
+     * FormatRegistry and the raw argument values.
+     * @param formatId Id returned by FormatRegistry::registerFormat().
+     * @param priority Priority of the message.
+     * @param args     Arguments for the format string.
+     * @return The deferred message.
+     */
+    template<typename... Args>
+    static Message deferred(Uint32          formatId,
+                            const Priority& priority,
+                            const Args&... args)
+    {
+        MessageBuffer buf;
+        encodeArgsTo(buf, args...);
+        return Message(formatId, std::move(buf), priority);
+    }
+
+    /**
+     * @brief Creates a deferred message from arguments already encoded, e.g.
+     * with encodeVarArgs().
+     * @param formatId Id returned by FormatRegistry.
+     * @param priority Priority of the message.
+     * @param args     Encoded arguments, moved from.
+     * @return The deferred message.
+     */
+    static Message deferredEncoded(Uint32          formatId,
+                                   const Priority& priority,
+                                   MessageBuffer&& args)
+    {
+        return Message(formatId, std::move(args), priority);
+    }
+
     /**
      * @brief Constructor for Message.
      * @param msg Log message.
      */
-    explicit Message(const String& msg);
+    explicit Message(StringView msg);
 
     /**
      * @brief Constructor for Message with priority.
      * @param msg Log message.
      * @param priority Priority of the message.
      */
-    explicit Message(const String& msg, Priority& priority);
+    explicit Message(StringView msg, const Priority& priority);
+
+    /**
+     * @brief Constructor for Message with priority and timestamp, used when
+     * reading messages back from a binary log.
+     * @param msg Log message.
+     * @param priority Priority of the message.
+     * @param timestamp Time the message was created.
+     */
+    explicit Message(StringView       msg,
+                     const Priority&  priority,
+                     const Timestamp& timestamp);
+
+    /**
+     * @brief Attaches a structured field, stored without formatting it.
+     * @param key   Name of the field.
+     * @param value Integer, floating point, string or pointer value.
+     * @return This message, to chain calls.
+     */
+    template<typename T>
+    Message& addField(StringView key, const T& value)
+    {
+        detail::encodeArg(m_msg, key);
+        detail::encodeArg(m_msg, value);
+        return *this;
+    }
+
+    /**
+     * @brief Attaches several structured fields.
+     * @param key   Name of the first field.
+     * @param value Value of the first field.
+     * @param rest  Further key, value pairs.
+     * @return This message, to chain calls.
+     */
+    template<typename T, typename... Rest>
+    Message& addFields(StringView key, const T& value, const Rest&... rest)
+    {
+        static_assert(sizeof...(Rest) % 2 == 0,
+                      "Fields are given as key, value pairs");
+        addField(key, value);
+        if constexpr (sizeof...(Rest) > 0) {
+            addFields(rest...);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Attaches fields in their encoded form, as returned by
+     * getEncodedFields(), e.g. when reading a binary log.
+     * @param fields Encoded fields.
+     * @return This message, to chain calls.
+     */
+    Message& addEncodedFields(StringView fields);
+
+    /**
+     * @brief Check if fields were attached.
+     * @return true if the message has at least one field.
+     */
+    bool hasFields() const;
+
+    /**
+     * @brief Get the fields in their encoded form.
+     * @return Encoded key, value pairs, empty if there are none.
+     */
+    StringView getEncodedFields() const;
 
     /**
-     * @brief Get the log message.
+     * @brief Decodes the fields, pointing into the message.
+     * @param fields Receives the fields in the order they were added,
+     * cleared first.
+     * @return false if the encoded fields are malformed.
+     */
+    bool getFields(std::vector<Field>& fields) const;
+
+    /**
+     * @brief Get the log message, with the fields appended as key=value.
      * @return Log message.
      */
     String getMsg() const;
 
+    /**
+     * @brief Appends getMsg() to out without temporary strings.
+     * @param out String to append to.
+     */
+    void appendMsg(String& out) const;
+
     /**
      * @brief Get the priority of the message.
      * @return Priority of the message.
@@ -155,5 +342,39 @@ class Message
      * @return Timestamp of the message.
      */
     Timestamp getTimestamp() const;
+
+    /**
+     * @brief Get the message text without timestamp and priority, formatting
+     * it first if the message is deferred.
+     * @return Message text.
+     */
+    String getText() const;
+
+    /**
+     * @brief Check if the message text is formatted only when written.
+     * @return true if created with deferred().
+     */
+    bool isDeferred() const;
+
+    /**
+     * @brief Get the format string id of a deferred message.
+     * @return Format id, or cNotDeferred.
+     */
+    Uint32 getFormatId() const;
+
+    /**
+     * @brief Compares everything but the timestamp.
+     * @param other Message to compare with.
+     * @return true if priority, text or format and arguments, and fields are
+     * the same.
+     */
+    bool hasSameContent(const Message& other) const;
+
+    /**
+     * @brief Get the raw payload: the text of a plain message or the encoded
+     * arguments of a deferred one.
+     * @return Payload bytes, valid as long as the message is not modified.
+     */
+    StringView getPayload() const;
 };
 } // namespace Au::Logger
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "Au/Types.hh"
+
+namespace Au::Logger {
+
+/**
+ * @class SlabAllocator
+ * @brief Hands out fixed size blocks for message payloads too long to be
+ * stored inline.
+ *
+ * Blocks come in power of two size classes from cMinBlockSize to
+ * cMaxBlockSize and are carved out of larger chunks that are never returned
+ * to the heap. Every thread keeps a small cache of free blocks per class and
+ * exchanges them with a shared pool cBlocksPerRefill at a time, so blocks
+ * allocated by a producer and freed by the logging thread circulate without
+ * touching the heap once the pool has grown to the working set. Longer
+ * payloads are allocated from the heap directly.
+ */
+class SlabAllocator
+{
+  public:
+    static constexpr size_t cMinBlockSize    = 256;
+    static constexpr size_t cMaxBlockSize    = 16384;
+    static constexpr size_t cBlocksPerRefill = 32;
+    static constexpr size_t cClassCount      = 7; ///< 256 to 16384 bytes
+
+    SlabAllocator(const SlabAllocator&)            = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    /**
+     * @brief Returns the process wide allocator.
+     * @return Reference to the allocator, never destroyed.
+     */
+    static SlabAllocator& get();
+
+    /**
+     * @brief Allocates a block of at least size bytes.
+     * @param size     Bytes needed.
+     * @param capacity Receives the usable size of the block, to be passed
+     * back to deallocate().
+     * @return The block.
+     */
+    char* allocate(size_t size, size_t& capacity);
+
+    /**
+     * @brief Returns a block, from any thread.
+     * @param block    Block from allocate().
+     * @param capacity Capacity reported by allocate().
+     */
+    void deallocate(char* block, size_t capacity);
+
+    /**
+     * @brief Bytes of slab chunks taken from the heap so far.
+     * @return Reserved bytes, grows only while the working set grows.
+     */
+    Uint64 getReservedBytes();
+
+    /**
+     * @brief Moves the free blocks cached by the calling thread to the shared
+     * pool, e.g. before a thread stops logging for good. Runs automatically
+     * when a thread exits.
+     */
+    void releaseThreadCache();
+
+  private:
+    std::mutex         m_mutex;             ///< Guards the members below
+    std::vector<char*> m_free[cClassCount]; ///< Shared pool per class
+    Uint64             m_reserved;          ///< Bytes taken from the heap
+
+    SlabAllocator();
+
+    /**
+     * @brief Size class for a block of size bytes, size <= cMaxBlockSize.
+     */
+    static size_t classOf(size_t size);
+
+    /**
+     * @brief Takes up to count free blocks of a class from the shared pool,
+     * carving a new chunk if it is empty. m_mutex must be held.
+     * @return Number of blocks stored to out.
+     */
+    size_t takeBlocks(size_t cls, char** out, size_t count);
+};
+
+/**
+ * @class MessageBuffer
+ * @brief Byte string holding the payload of a Message.
+ *
+ * Payloads of up to cInlineCapacity bytes, most log lines, are stored inside
+ * the object. Longer ones live in a SlabAllocator block. Moving a buffer
+ * never allocates; it copies the inline bytes or takes over the block.
+ */
+class MessageBuffer
+{
+  public:
+    static constexpr size_t cInlineCapacity = 88;
+
+    MessageBuffer();
+
+    /**
+     * @brief Constructs a buffer holding a copy of text.
+     * @param text Payload bytes.
+     */
+    explicit MessageBuffer(StringView text);
+
+    MessageBuffer(const MessageBuffer& other);
+    MessageBuffer(MessageBuffer&& other) noexcept;
+    MessageBuffer& operator=(const MessageBuffer& other);
+    MessageBuffer& operator=(MessageBuffer&& other) noexcept;
+    ~MessageBuffer();
+
+    /**
+     * @brief Appends bytes, growing into a larger block if needed.
+     * @param data Bytes to append.
+     * @param size Number of bytes.
+     */
+    void append(const char* data, size_t size);
+
+    /**
+     * @brief Appends a single byte.
+     * @param c Byte to append.
+     */
+    void push_back(char c) { append(&c, 1); }
+
+    /**
+     * @brief Makes sure size bytes fit without further growth.
+     * @param size Total bytes expected.
+     */
+    void reserve(size_t size);
+
+    /**
+     * @brief Empties the buffer, keeping its block.
+     */
+    void clear() { m_size = 0; }
+
+    const char* data() const { return m_data; }
+    size_t      size() const { return m_size; }
+    bool        empty() const { return m_size == 0; }
+    StringView  view() const { return StringView(m_data, m_size); }
+
+    /**
+     * @brief Checks if the payload is stored inside the object.
+     * @return false if it lives in a SlabAllocator block.
+     */
+    bool isInline() const { return m_data == m_inline; }
+
+  private:
+    char*  m_data;     ///< m_inline or a SlabAllocator block
+    Uint32 m_size;     ///< Bytes in use
+    Uint32 m_capacity; ///< Bytes available at m_data
+    char   m_inline[cInlineCapacity]; ///< Storage for short payloads
+
+    /**
+     * @brief Moves the payload into a block of at least size bytes.
+     */
+    void grow(size_t size);
+
+    /**
+     * @brief Returns the block, if any, and switches back to inline storage.
+     */
+    void release();
+};
+} // namespace Au::Logger
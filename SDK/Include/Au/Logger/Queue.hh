@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -29,9 +29,102 @@
 #pragma once
 #include "Au/Logger/Message.hh"
 #include <deque>
+#include <optional>
+#include <vector>
 namespace Au::Logger {
 
-class LockingQueue
+/**
+ * @enum OverflowPolicy
+ * @brief Action taken by a bounded queue when a producer finds it full.
+ */
+enum class OverflowPolicy
+{
+    eBlock,      ///< Producer waits until the consumer frees a slot
+    eDropNewest, ///< The message being enqueued is discarded
+    eDropOldest, ///< The oldest queued message is discarded to make room
+};
+
+/**
+ * @brief Callback receiving one message, see IQueue::visitPending().
+ */
+using MessageVisitor = void (*)(const Message& msg, void* ctx);
+
+/**
+ * @class IQueue
+ * @brief Abstract interface for the queue between producers and LogWriter.
+ *
+ * Any number of threads may enqueue, only the LogWriter thread dequeues.
+ */
+class IQueue
+{
+  public:
+    /**
+     * @brief Adds a message to the queue.
+     * @param msg The log message.
+     */
+    virtual void enqueue(const Message& msg) = 0;
+
+    /**
+     * @brief Adds a message to the queue, moving it instead of copying.
+     * @param msg The log message.
+     */
+    virtual void enqueue(Message&& msg) = 0;
+
+    /**
+     * @brief Removes the oldest message from the queue.
+     * @return The message, or a placeholder message if the queue is empty.
+     */
+    virtual Message dequeue() = 0;
+
+    /**
+     * @brief Removes the oldest message from the queue if one is available.
+     * @param msg Receives the message on success.
+     * @return true if a message was removed, false if the queue was empty.
+     */
+    virtual bool tryDequeue(Message& msg) = 0;
+
+    /**
+     * @brief Checks if the queue holds no messages.
+     * @return true if empty.
+     */
+    virtual bool empty() = 0;
+
+    /**
+     * @brief Number of messages currently held by the queue.
+     * @return Message count.
+     */
+    virtual Uint64 getCount() = 0;
+
+    /**
+     * @brief Number of messages discarded because the queue was full.
+     * @return Dropped message count.
+     */
+    virtual Uint64 getDroppedCount() = 0;
+
+    /**
+     * @brief Calls visitor for the messages still queued, without taking
+     * locks or allocating, so that it can run in a signal handler.
+     *
+     * Meant for crash time only: producers and the LogWriter thread may
+     * still be using the queue, so the result is best effort. The default
+     * visits nothing.
+     * @param visitor Called once per message, oldest first per producer.
+     * @param ctx     Passed to visitor.
+     */
+    virtual void visitPending(MessageVisitor visitor, void* ctx)
+    {
+        (void)visitor;
+        (void)ctx;
+    }
+
+    virtual ~IQueue() = default;
+};
+
+/**
+ * @class LockingQueue
+ * @brief Unbounded queue guarded by a single mutex.
+ */
+class LockingQueue : public IQueue
 {
   private:
     std::mutex          m_mutex;
@@ -44,22 +137,188 @@ class LockingQueue
     LockingQueue(const LockingQueue&)            = delete;
     LockingQueue& operator=(const LockingQueue&) = delete;
 
-    void    enqueue(const Message& msg);
-    Message dequeue();
-    bool    empty();
-    Uint64  getCount();
+    void    enqueue(const Message& msg) override;
+    void    enqueue(Message&& msg) override;
+    Message dequeue() override;
+    bool    tryDequeue(Message& msg) override;
+    bool    empty() override;
+    Uint64  getCount() override;
+    Uint64  getDroppedCount() override;
+    void    visitPending(MessageVisitor visitor, void* ctx) override;
 
-    ~LockingQueue() = default;
+    ~LockingQueue() override = default;
 };
 
-// Classes implementing no locking queue
+/**
+ * @class RingQueue
+ * @brief Bounded lock-free multi-producer/single-consumer ring buffer.
+ *
+ * Every slot carries a sequence number which tells producers and the
+ * consumer whether the slot is free or holds a published message, so neither
+ * side takes a lock. Slots and the head/tail indices live on separate cache
+ * lines to avoid false sharing between producers and the LogWriter thread.
+ */
+class RingQueue : public IQueue
+{
+  public:
+    static constexpr size_t cCacheLineSize   = 64;
+    static constexpr size_t cDefaultCapacity = 8192;
+
+    /**
+     * @brief Constructor for RingQueue.
+     * @param capacity Number of slots, rounded up to the next power of two.
+     * @param policy   What to do when a producer finds the queue full.
+     */
+    explicit RingQueue(size_t         capacity = cDefaultCapacity,
+                       OverflowPolicy policy   = OverflowPolicy::eBlock);
+
+    // Disable copy constructor and assignment operator
+    RingQueue(const RingQueue&)            = delete;
+    RingQueue& operator=(const RingQueue&) = delete;
+
+    void    enqueue(const Message& msg) override;
+    void    enqueue(Message&& msg) override;
+    Message dequeue() override;
+    bool    tryDequeue(Message& msg) override;
+    bool    empty() override;
+    Uint64  getCount() override;
+    Uint64  getDroppedCount() override;
+    void    visitPending(MessageVisitor visitor, void* ctx) override;
 
-class NoLockQueueElement
+    /**
+     * @brief Number of slots in the ring.
+     * @return Capacity of the queue.
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Overflow policy of the queue.
+     * @return Policy given at construction.
+     */
+    OverflowPolicy getOverflowPolicy() const;
+
+    ~RingQueue() override = default;
+
+  private:
+    struct alignas(cCacheLineSize) Slot
+    {
+        std::atomic<Uint64>    m_sequence{ 0 };
+        std::optional<Message> m_msg{};
+    };
+
+    /**
+     * @brief Claims a free slot and moves the message into it.
+     * @return false if the queue is full, msg is left untouched.
+     */
+    bool tryEnqueue(Message&& msg);
+
+    /**
+     * @brief Claims the oldest published slot and releases it.
+     * @return false if no message is published yet.
+     */
+    bool tryPop(std::optional<Message>& msg);
+
+    const Uint64            m_mask;
+    const OverflowPolicy    m_policy;
+    std::unique_ptr<Slot[]> m_slots;
+
+    alignas(cCacheLineSize) std::atomic<Uint64> m_head; ///< Next slot to read
+    alignas(cCacheLineSize) std::atomic<Uint64> m_tail; ///< Next slot to write
+    alignas(cCacheLineSize) std::atomic<Uint64> m_dropped;
+};
+
+/**
+ * @class PerThreadQueue
+ * @brief One bounded single-producer/single-consumer ring buffer per logging
+ * thread, drained directly by the LogWriter thread.
+ *
+ * A thread's buffer is registered the first time it logs and retired when
+ * the thread exits; the LogWriter thread releases it once it is empty. On the
+ * hot path a producer only touches its own buffer, so threads never contend
+ * with each other. Messages of one thread stay in order, messages of
+ * different threads are interleaved in no particular order.
+ */
+class PerThreadQueue : public IQueue
 {
   public:
-    Message m_msg;
-    explicit NoLockQueueElement(const Message msg);
-    std::atomic<NoLockQueueElement*> m_next;
+    static constexpr size_t cCacheLineSize   = 64;
+    static constexpr size_t cDefaultCapacity = 1024;
+
+    /**
+     * @brief Constructor for PerThreadQueue.
+     * @param capacity Slots per thread, rounded up to the next power of two.
+     * @param policy   What to do when a producer finds its buffer full. Only
+     * the LogWriter thread may remove messages, so eDropOldest behaves like
+     * eDropNewest.
+     */
+    explicit PerThreadQueue(size_t         capacity = cDefaultCapacity,
+                            OverflowPolicy policy   = OverflowPolicy::eBlock);
+
+    // Disable copy constructor and assignment operator
+    PerThreadQueue(const PerThreadQueue&)            = delete;
+    PerThreadQueue& operator=(const PerThreadQueue&) = delete;
+
+    void    enqueue(const Message& msg) override;
+    void    enqueue(Message&& msg) override;
+    Message dequeue() override;
+    bool    tryDequeue(Message& msg) override;
+    bool    empty() override;
+    Uint64  getCount() override;
+    Uint64  getDroppedCount() override;
+    void    visitPending(MessageVisitor visitor, void* ctx) override;
+
+    /**
+     * @brief Number of slots in each thread's buffer.
+     * @return Per-thread capacity.
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Number of registered buffers, including those of exited threads
+     * that still hold messages.
+     * @return Buffer count.
+     */
+    size_t getBufferCount();
+
+    ~PerThreadQueue() override;
+
+  private:
+    struct Buffer;
+
+    /**
+     * @brief Buffer of the calling thread, registered on first use.
+     */
+    Buffer& getBuffer();
+
+    /**
+     * @brief Refreshes the consumer's view of the registered buffers.
+     * LogWriter thread only.
+     * @param releaseRetired Also release empty buffers of exited threads.
+     */
+    void refreshBuffers(bool releaseRetired);
+
+    /**
+     * @brief Takes the next message from the consumer's view of the buffers.
+     * LogWriter thread only.
+     * @return false if all buffers were empty.
+     */
+    bool tryPop(Message& msg);
+
+    const Uint64         m_id; ///< Tells queues apart in thread local lookups
+    const size_t         m_capacity;
+    const OverflowPolicy m_policy;
+
+    std::mutex                           m_mutex;   ///< Guards m_buffers
+    std::vector<std::shared_ptr<Buffer>> m_buffers; ///< All registered buffers
+    std::atomic<Uint64> m_version; ///< Bumped whenever m_buffers changes
+
+    // Consumer side, only used by the LogWriter thread
+    std::vector<std::shared_ptr<Buffer>> m_active; ///< Copy of m_buffers
+    Uint64 m_activeVersion;                        ///< Version of m_active
+    size_t m_next;                                 ///< Buffer to read next
+    size_t m_burst; ///< Messages taken from m_next in a row
+
+    alignas(cCacheLineSize) std::atomic<Uint64> m_dropped;
 };
 
 } // namespace Au::Logger
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "Au/Types.hh"
+
+namespace Au::Logger {
+
+/**
+ * @class RateLimiter
+ * @brief Lets at most a given number of calls per second through, used by
+ * the AU_LOGGER_LOG* macros to limit each call site.
+ *
+ * Only relaxed atomics are used, concurrent callers may occasionally let a
+ * call more or less through than the limit. Calls that are turned away are
+ * counted and reported to the next call that passes.
+ */
+class RateLimiter
+{
+  private:
+    std::atomic<Uint64> m_window;     ///< Second the count belongs to
+    std::atomic<Uint32> m_count;      ///< Calls seen in m_window
+    std::atomic<Uint64> m_suppressed; ///< Calls turned away, not reported
+
+    /**
+     * @brief Current second of a coarse monotonic clock.
+     */
+    static Uint64 currentWindow();
+
+  public:
+    constexpr RateLimiter()
+        : m_window{ 0 }
+        , m_count{ 0 }
+        , m_suppressed{ 0 }
+    {
+    }
+
+    RateLimiter(const RateLimiter&)            = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * @brief Counts a call and decides whether it may log.
+     * @param perSecond Calls allowed per second, 0 for no limit.
+     * @param suppressed Receives the number of calls turned away since the
+     * last one allowed, if this call is allowed.
+     * @return true if the call may log.
+     */
+    bool allow(Uint32 perSecond, Uint64& suppressed)
+    {
+        suppressed = 0;
+        if (perSecond == 0) {
+            return true;
+        }
+
+        Uint64 window = currentWindow();
+        Uint64 seen   = m_window.load(std::memory_order_relaxed);
+        if (window != seen
+            && m_window.compare_exchange_strong(
+                seen, window, std::memory_order_relaxed)) {
+            m_count.store(0, std::memory_order_relaxed);
+        }
+
+        // Plain load first, a flood of suppressed calls does not keep
+        // writing the count
+        if (m_count.load(std::memory_order_relaxed) >= perSecond
+            || m_count.fetch_add(1, std::memory_order_relaxed) >= perSecond) {
+            m_suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (m_suppressed.load(std::memory_order_relaxed) != 0) {
+            suppressed = m_suppressed.exchange(0, std::memory_order_relaxed);
+        }
+        return true;
+    }
+};
+} // namespace Au::Logger
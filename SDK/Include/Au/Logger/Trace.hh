@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Au/Config.h"
+#include "Au/Types.hh"
+
+#if AU_CPU_ARCH_X86
+#if defined(_WIN32) || defined(_WIN64)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace Au::Logger {
+
+/**
+ * @struct TraceEvent
+ * @brief A completed span, times in Tracer::now() ticks.
+ */
+struct TraceEvent
+{
+    const char* name;  ///< Name given to AU_TRACE_SCOPE, not copied
+    Uint64      begin; ///< Tick the span was entered
+    Uint64      end;   ///< Tick the span was left
+};
+
+/**
+ * @class Tracer
+ * @brief Collects the spans of AU_TRACE_SCOPE in per-thread buffers and
+ * exports them in the Chrome trace event format, which chrome://tracing and
+ * Perfetto read.
+ *
+ * Recording is off until setEnabled(true). A thread gets its buffer on its
+ * first span and the buffer grows in blocks. When the thread exits the
+ * buffer is kept until its spans have been exported with getEvents() or
+ * exportChromeJson(), then given to the next new thread, or freed by
+ * clear(). A thread that has recorded cMaxEvents spans drops further ones.
+ */
+class Tracer
+{
+  public:
+    static constexpr size_t cBlockEvents = 4096; ///< Events per allocation
+    static constexpr size_t cMaxEvents   = 64 * cBlockEvents; ///< Per thread
+
+  private:
+    struct Buffer;
+
+    std::mutex                            m_mutex;      ///< Guards m_buffers
+    std::vector<std::unique_ptr<Buffer>>  m_buffers;    ///< One per thread
+    Uint32                                m_threads;    ///< Numbers given
+    Uint64                                m_startTicks; ///< now() at creation
+    std::chrono::steady_clock::time_point m_startTime;  ///< Clock at creation
+
+    static std::atomic<bool> enabled; ///< Spans are being recorded
+
+    Tracer();
+
+    /**
+     * @brief Creates and registers the buffer of the calling thread.
+     */
+    Buffer* addBuffer();
+
+    /**
+     * @brief Called when the owner of a buffer exits, frees the buffer if it
+     * holds no spans.
+     */
+    void releaseBuffer(Buffer* buffer);
+
+  public:
+    Tracer(const Tracer&)            = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    /**
+     * @brief The process wide tracer, never destroyed.
+     */
+    static Tracer& get();
+
+    /**
+     * @brief Starts or stops recording spans, off by default.
+     * @param enable Whether spans are recorded.
+     */
+    static void setEnabled(bool enable);
+
+    /**
+     * @brief Checks whether spans are recorded, a relaxed load.
+     * @return true if recording.
+     */
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Reads the trace clock, the time stamp counter on x86 and the
+     * steady clock elsewhere. Converted to time on export.
+     * @return Current tick.
+     */
+    static Uint64 now()
+    {
+#if AU_CPU_ARCH_X86
+        return __rdtsc();
+#else
+        return static_cast<Uint64>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /**
+     * @brief Appends a span to the buffer of the calling thread.
+     * @param name Span name, must outlive the tracer, e.g. a string literal.
+     * @param begin Tick the span was entered.
+     * @param end Tick the span was left.
+     */
+    static void record(const char* name, Uint64 begin, Uint64 end);
+
+    /**
+     * @brief Number of spans recorded by all threads.
+     */
+    size_t getEventCount();
+
+    /**
+     * @brief Number of spans dropped because a thread's buffer was full.
+     */
+    Uint64 getDroppedCount();
+
+    /**
+     * @brief Copies the recorded spans of all threads.
+     * @param events Receives the spans, grouped by thread.
+     * @param threads Receives the thread number of every span.
+     */
+    void getEvents(std::vector<TraceEvent>& events,
+                   std::vector<Uint32>&     threads);
+
+    /**
+     * @brief Number of thread buffers held, those of running threads and of
+     * exited threads whose spans are kept for export.
+     */
+    size_t getBufferCount();
+
+    /**
+     * @brief Writes the recorded spans as a Chrome trace event JSON
+     * document, one complete ("X") event per span, times in microseconds
+     * since the tracer was created.
+     * @param out Stream to write to.
+     */
+    void exportChromeJson(std::ostream& out);
+
+    /**
+     * @brief Writes exportChromeJson() output to a file.
+     * @param filename File to create or truncate.
+     * @return false if the file could not be written.
+     */
+    bool writeChromeJson(const String& filename);
+
+    /**
+     * @brief Discards the recorded spans, freeing the buffers of exited
+     * threads. Must not be called while spans are being recorded.
+     */
+    void clear();
+};
+
+/**
+ * @class TraceScope
+ * @brief Records a span from its construction to its destruction, see
+ * AU_TRACE_SCOPE.
+ */
+class TraceScope
+{
+  private:
+    const char* m_name;  ///< Span name
+    Uint64      m_begin; ///< Tick at construction, 0 if not recording
+
+  public:
+    explicit TraceScope(const char* name)
+        : m_name{ name }
+        , m_begin{ Tracer::isEnabled() ? Tracer::now() : 0 }
+    {
+    }
+
+    TraceScope(const TraceScope&)            = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope()
+    {
+        if (m_begin != 0) {
+            Tracer::record(m_name, m_begin, Tracer::now());
+        }
+    }
+};
+} // namespace Au::Logger
+
+#define AU_TRACE_CONCAT_(a, b) a##b
+#define AU_TRACE_CONCAT(a, b)  AU_TRACE_CONCAT_(a, b)
+
+/*
+ * Records the rest of the enclosing block as a span named name, a string
+ * literal. Compiled out entirely unless AU_TRACE_ENABLED is 1 (CMake option
+ * AU_ENABLE_TRACE), costs one relaxed load while Tracer recording is off.
+ */
+#if AU_TRACE_ENABLED
+#define AU_TRACE_SCOPE(name)                                                   \
+    Au::Logger::TraceScope AU_TRACE_CONCAT(auTraceScope, __LINE__)(name)
+#else
+#define AU_TRACE_SCOPE(name) ((void)0)
+#endif
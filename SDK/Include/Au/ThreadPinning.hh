@@ -22,6 +22,7 @@
 
 #pragma once
 #include "Au/Config.h"
+#include "Au/Status.hh"
 #include <memory>
 #include <vector>
 
@@ -36,7 +37,10 @@ enum pinStrategy
 {
     SPREAD,
     CORE,
-    LOGICAL
+    LOGICAL,
+    NUMA_COMPACT,
+    NUMA_SPREAD,
+    CACHE_COMPACT
 };
 
 class ThreadPinning
@@ -44,6 +48,18 @@ class ThreadPinning
   public:
     ThreadPinning();
     ~ThreadPinning();
+
+    /**
+     * @brief          initTopology
+     *
+     * @details        Read the processor topology now. It is otherwise read
+     * on first use, i.e. by the first ThreadPinning object, which may be
+     * inside a timed region. Calling it more than once is harmless.
+     *
+     * @return         None
+     */
+    static void initTopology();
+
     /**
      * @brief          PinThreads
      *
@@ -57,16 +73,65 @@ class ThreadPinning
      *        Pin the threads to the physical cores
      *  2 - Logical
      *        Processor Pin the threads to the logical processors
+     *  3 - NUMA Compact
+     *        Fill one NUMA node after the other, physical cores first
+     *  4 - NUMA Spread
+     *        Split the threads into equal blocks, one per NUMA node
+     *  5 - Cache Compact
+     *        Fill one L3 cache (CCX) after the other, physical cores first
      *
      * @param[in]      threadList        ThreadIDs to pin
      *
      * @param[in]      pinStrategyIndex  0 - spread , 1 - Core, 2 - Logical
-     * Processor
+     * Processor, 3 - NUMA compact, 4 - NUMA spread, 5 - Cache compact
      *
-     * @return         None
+     * @return         StatusOk() if every thread was pinned, otherwise the
+     * first failure, e.g. InvalidArgument for a processor outside the
+     * allowed set of the process
+     */
+    Status pinThreads(std::vector<pthread_t> const& threadList,
+                      int                           pinStrategyIndex);
+
+    /**
+     * @brief          PinThreads
+     *
+     * @details        Pin Threads like pinThreads() above, with the spread and
+     * cache compact strategies working on the caches of the given level
+     * instead of L3, e.g. spread with level 2 places one thread per L2. Other
+     * strategies ignore the level. An unknown level falls back to L3.
+     *
+     * @param[in]      threadList        ThreadIDs to pin
+     *
+     * @param[in]      pinStrategyIndex  0 - spread , 1 - Core, 2 - Logical
+     * Processor, 3 - NUMA compact, 4 - NUMA spread, 5 - Cache compact
+     *
+     * @param[in]      cacheLevel        Cache level, 1 to 3
+     *
+     * @return         Status, as for pinThreads() above
+     */
+    Status pinThreads(std::vector<pthread_t> const& threadList,
+                      int                           pinStrategyIndex,
+                      int                           cacheLevel);
+
+    /**
+     * @brief          PinThreads
+     *
+     * @details        Pin Threads like pinThreads() above and report the NUMA
+     * node each thread was pinned to, so that callers can first-touch the
+     * data of each thread on its node.
+     *
+     * @param[in]      threadList        ThreadIDs to pin
+     *
+     * @param[in]      pinStrategyIndex  0 - spread , 1 - Core, 2 - Logical
+     * Processor, 3 - NUMA compact, 4 - NUMA spread, 5 - Cache compact
+     *
+     * @param[out]     numaNodes         NUMA node per thread, -1 if unknown
+     *
+     * @return         Status, as for pinThreads() above
      */
-    void pinThreads(std::vector<pthread_t> const& threadList,
-                    int                           pinStrategyIndex);
+    Status pinThreads(std::vector<pthread_t> const& threadList,
+                      int                           pinStrategyIndex,
+                      std::vector<int>&             numaNodes);
 
     /**
      * @brief          pinThreads
@@ -95,9 +160,10 @@ class ThreadPinning
      *
      * @param[in]      processPinGroup   Processor Group to pin the threads
      *
+     * @return         Status, as for pinThreads() above
      */
-    void pinThreads(std::vector<pthread_t> const& threadList,
-                    std::vector<int> const&       processPinGroup);
+    Status pinThreads(std::vector<pthread_t> const& threadList,
+                      std::vector<int> const&       processPinGroup);
 
   private:
     class Impl;
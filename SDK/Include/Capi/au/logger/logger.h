@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -32,9 +32,16 @@
 #include "Au/Config.h"
 #include "Au/Defs.hh"
 #include "Capi/au/macros.h"
+#include "Capi/au/types.h"
 
 #include "Capi/au/logger_ctx.h"
 
+#ifdef __cplusplus
+#include <cstdarg>
+#else
+#include <stdarg.h>
+#endif
+
 AUD_EXTERN_C_BEGIN
 
 /**
@@ -53,9 +60,35 @@ typedef enum
     AUD_LOG_LEVEL_FATAL
 } log_level_t;
 
+/**
+ * @struct au_logger_stats_t
+ * @brief Counters of the logging pipeline, accumulated over the life of the
+ * process.
+ */
+typedef struct
+{
+    uint64_t messages_written;       /**< Messages handed to the logger */
+    uint64_t messages_dropped;       /**< Discarded by a full queue */
+    uint64_t bytes_written;          /**< Bytes the logger wrote */
+    uint64_t queue_depth;            /**< Messages queued, 0 once drained */
+    uint64_t max_queue_depth;        /**< Highest queue_depth seen */
+    uint64_t enqueue_samples;        /**< Log calls timed */
+    uint64_t enqueue_latency_avg_ns; /**< Mean time to queue a message */
+    uint64_t enqueue_latency_max_ns; /**< Longest time to queue a message */
+    uint64_t writer_busy_ns;         /**< Time the writer thread wrote */
+    uint64_t writer_run_ns;          /**< Time the writer thread ran */
+    double   writer_utilization;     /**< writer_busy_ns / writer_run_ns */
+} au_logger_stats_t;
+
 /**
  * @brief Creates a new logger context for the C-API.
  *
+ * Contexts share the logging thread, which keeps running until the process
+ * exits. Any number of contexts may be alive at once. A context stays valid
+ * across LogWriter::shutdown(), its next call starts a new logging thread.
+ * Every call logs through the running writer whatever context it is given,
+ * NULL included; a context only decides when au_logger_destroy() flushes.
+ *
  * @return A pointer to the newly allocated logger context.
  */
 AUD_API_EXPORT logger_ctx_t*
@@ -64,7 +97,7 @@ au_logger_create();
 /**
  * @brief Logs a message at the specified log level.
  *
- * @param[in] logger  Pointer to the logger context.
+ * @param[in] logger  Pointer to the logger context, or NULL.
  * @param[in] message Null-terminated string message.
  * @param[in] level   Desired log severity level.
  */
@@ -72,9 +105,47 @@ AUD_API_EXPORT void
 au_logger_log(logger_ctx_t* logger, const char* message, log_level_t level);
 
 /**
- * @brief Forces any buffered messages to be flushed.
+ * @brief Logs a printf-style message, formatted later by the logging thread.
  *
- * @param[in] logger  Pointer to the logger context.
+ * A call below the runtime log level returns before reading its arguments.
+ * Otherwise only the argument values are captured, strings are copied. '*'
+ * widths and precisions are not supported.
+ *
+ * Every distinct format text is registered for the life of the process, so
+ * format should come from a small, fixed set of strings such as literals.
+ * Past a limit of distinct texts, new formats are formatted on the calling
+ * thread instead, which is slower.
+ *
+ * @param[in] logger  Pointer to the logger context, or NULL.
+ * @param[in] level   Desired log severity level.
+ * @param[in] format  printf-style format string.
+ * @param[in] ...     Arguments for format.
+ */
+AUD_API_EXPORT void
+au_logger_logf(logger_ctx_t* logger,
+               log_level_t   level,
+               const char*   format,
+               ...);
+
+/**
+ * @brief Same as au_logger_logf(), taking a va_list.
+ *
+ * @param[in] logger  Pointer to the logger context, or NULL.
+ * @param[in] level   Desired log severity level.
+ * @param[in] format  printf-style format string.
+ * @param[in] args    Arguments for format.
+ */
+AUD_API_EXPORT void
+au_logger_vlogf(logger_ctx_t* logger,
+                log_level_t   level,
+                const char*   format,
+                va_list       args);
+
+/**
+ * @brief Waits until the messages logged so far have been written and the
+ * output flushed.
+ *
+ * @param[in] logger  Pointer to the logger context, or NULL.
  */
 AUD_API_EXPORT void
 au_logger_flush(logger_ctx_t* logger);
@@ -82,11 +153,23 @@ au_logger_flush(logger_ctx_t* logger);
 /**
  * @brief Destroys the logger context and releases its resources.
  *
+ * Other contexts are not affected. Destroying the last one flushes the
+ * messages logged so far.
+ *
  * @param[in] logger  Pointer to the logger context.
  */
 AUD_API_EXPORT void
 au_logger_destroy(logger_ctx_t* logger);
 
+/**
+ * @brief Reads the logging pipeline counters without locking, meant to be
+ * called periodically, e.g. to size queues or spot back-pressure.
+ *
+ * @param[out] stats  Receives the counters, ignored if NULL.
+ */
+AUD_API_EXPORT void
+au_logger_get_stats(au_logger_stats_t* stats);
+
 AUD_EXTERN_C_END
 
 #endif // __AU_LOGGER_LOGGER_H__
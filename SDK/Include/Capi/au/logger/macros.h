@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ * Copyright (C) 2024-2026, Advanced Micro Devices. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -48,4 +48,7 @@
 #define AUD_LOG_TRACE(msg) AUD_LOG(AUD_LOG_LEVEL_TRACE, msg)
 #define AUD_LOG_FATAL(msg) AUD_LOG(AUD_LOG_LEVEL_FATAL, msg)
 
+// Deferred printf-style logging on the global writer, asynchronous
+#define AUD_LOGF(level, ...) au_logger_logf(NULL, level, __VA_ARGS__)
+
 #endif /* __AU_LOGGER_MACROS_H__ */
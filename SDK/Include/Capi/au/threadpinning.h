@@ -40,6 +40,21 @@ typedef HANDLE pthread_t;
 #include <stddef.h>
 #include <sys/types.h>
 #endif
+// After _GNU_SOURCE, error.h pulls in system headers
+#include "Capi/au/error.h"
+
+/**
+ * @brief          Read the processor topology.
+ *
+ * @details        The topology is read once per process, on first use by
+ * default. Call this early, e.g. at startup, so the first au_pin_threads_*()
+ * call does not pay for it. Calling it more than once is harmless.
+ *
+ * @return         void
+ */
+AUD_API_EXPORT
+void
+au_topology_init(void);
 
 /**
  * @brief          Pin threads to the processor group using pinStrateg::CORE.
@@ -66,10 +81,13 @@ typedef HANDLE pthread_t;
  * @param[in]      threadList      List of threads to pin.
  * @param[in]      threadListSize  Number of threads in the list.
  *
- * @return         void
+ * @return         eError_Ok if all threads were pinned, eError_BadPointer
+ *                 for a NULL threadList, eError_InvalidArgument for bad
+ *                 arguments or a processor outside the allowed set of the
+ *                 process, eError_Generic otherwise
  */
 AUD_API_EXPORT
-void
+au_error_t
 au_pin_threads_core(pthread_t* threadList, size_t threadListSize);
 
 /**
@@ -98,10 +116,10 @@ au_pin_threads_core(pthread_t* threadList, size_t threadListSize);
  * @param[in]      threadList      List of threads to pin.
  * @param[in]      threadListSize  Number of threads in the list.
  *
- * @return         void
+ * @return         eError_Ok on success, as for au_pin_threads_core()
  */
 AUD_API_EXPORT
-void
+au_error_t
 au_pin_threads_logical(pthread_t* threadList, size_t threadListSize);
 
 /**
@@ -117,12 +135,126 @@ au_pin_threads_logical(pthread_t* threadList, size_t threadListSize);
  * @param[in]      threadList      List of threads to pin.
  * @param[in]      threadListSize  Number of threads in the list.
  *
- * @return         void
+ * @return         eError_Ok on success, as for au_pin_threads_core()
  */
 AUD_API_EXPORT
-void
+au_error_t
 au_pin_threads_spread(pthread_t* threadList, size_t threadListSize);
 
+/**
+ * @brief          Pin threads using pinStrategy::NUMA_COMPACT.
+ *
+ * @details        This function will fill the NUMA nodes one after the other,
+ * placing one thread per physical core of a node before using the SMT
+ * siblings, and only then moving to the next node. Threads that share data
+ * stay on the same node.
+ *
+ * Example: two nodes with two SMT cores each, node 0 is [0, 1, 4, 5] and
+ * node 1 is [2, 3, 6, 7] (4 and 5 are siblings of 0 and 1).
+ * | Thread List Index | Logical Core Index | NUMA Node |
+ * |-------------------|--------------------|-----------|
+ * | 0                 | 0                  | 0         |
+ * | 1                 | 1                  | 0         |
+ * | 2                 | 4                  | 0         |
+ * | 3                 | 5                  | 0         |
+ * | 4                 | 2                  | 1         |
+ *
+ * @param[in]      threadList      List of threads to pin.
+ * @param[in]      threadListSize  Number of threads in the list.
+ * @param[out]     numaNodes       NUMA node of each thread, -1 if unknown.
+ *                                 Array of threadListSize entries, may be
+ *                                 NULL.
+ *
+ * @return         eError_Ok on success, as for au_pin_threads_core()
+ */
+AUD_API_EXPORT
+au_error_t
+au_pin_threads_numa_compact(pthread_t* threadList,
+                            size_t     threadListSize,
+                            int*       numaNodes);
+
+/**
+ * @brief          Pin threads using pinStrategy::NUMA_SPREAD.
+ *
+ * @details        This function will split the threads into equal contiguous
+ * blocks, one per NUMA node, so that every node gets the same share of the
+ * memory bandwidth. Within a node the physical cores are used first.
+ *
+ * Example: with the machine above and threadList [0, 1, 2, 3]
+ * | Thread List Index | Logical Core Index | NUMA Node |
+ * |-------------------|--------------------|-----------|
+ * | 0                 | 0                  | 0         |
+ * | 1                 | 1                  | 0         |
+ * | 2                 | 2                  | 1         |
+ * | 3                 | 3                  | 1         |
+ *
+ * The memory used by a thread should be first touched by that thread (or on
+ * the node reported in numaNodes) so that it is allocated on the local node.
+ *
+ * @param[in]      threadList      List of threads to pin.
+ * @param[in]      threadListSize  Number of threads in the list.
+ * @param[out]     numaNodes       NUMA node of each thread, -1 if unknown.
+ *                                 Array of threadListSize entries, may be
+ *                                 NULL.
+ *
+ * @return         eError_Ok on success, as for au_pin_threads_core()
+ */
+AUD_API_EXPORT
+au_error_t
+au_pin_threads_numa_spread(pthread_t* threadList,
+                           size_t     threadListSize,
+                           int*       numaNodes);
+
+/**
+ * @brief          Pin threads using pinStrategy::SPREAD on a cache level.
+ *
+ * @details        Like au_pin_threads_spread(), but the threads are spread
+ * over the caches of the given level instead of L3. With level 2 on parts with
+ * a private L2 every thread gets its own L2 while there are enough cores.
+ * An unknown level falls back to L3.
+ *
+ * @param[in]      threadList      List of threads to pin.
+ * @param[in]      threadListSize  Number of threads in the list.
+ * @param[in]      cacheLevel      Cache level, 1 to 3.
+ *
+ * @return         eError_Ok on success, as for au_pin_threads_core()
+ */
+AUD_API_EXPORT
+au_error_t
+au_pin_threads_cache_spread(pthread_t* threadList,
+                            size_t     threadListSize,
+                            int        cacheLevel);
+
+/**
+ * @brief          Pin threads using pinStrategy::CACHE_COMPACT.
+ *
+ * @details        This function fills the caches of the given level one after
+ * the other, one thread per physical core first and then the SMT siblings.
+ * With level 3 one CCX is filled before the next, so that threads sharing
+ * data also share the L3.
+ *
+ * Example: two L3 caches of two SMT cores each, L3 0 is [0, 1, 4, 5] and
+ * L3 1 is [2, 3, 6, 7] (4 and 5 are siblings of 0 and 1).
+ * | Thread List Index | Logical Core Index |
+ * |-------------------|--------------------|
+ * | 0                 | 0                  |
+ * | 1                 | 1                  |
+ * | 2                 | 4                  |
+ * | 3                 | 5                  |
+ * | 4                 | 2                  |
+ *
+ * @param[in]      threadList      List of threads to pin.
+ * @param[in]      threadListSize  Number of threads in the list.
+ * @param[in]      cacheLevel      Cache level, 1 to 3.
+ *
+ * @return         eError_Ok on success, as for au_pin_threads_core()
+ */
+AUD_API_EXPORT
+au_error_t
+au_pin_threads_cache_compact(pthread_t* threadList,
+                             size_t     threadListSize,
+                             int        cacheLevel);
+
 /**
  * @brief          Pin threads to the processor group using custom affinity
  * vector.
@@ -145,10 +277,10 @@ au_pin_threads_spread(pthread_t* threadList, size_t threadListSize);
  * @param[in]      affinityVector  Custom affinity vector.
  * @param[in]      affinityVectorSize  Size of the affinity vector.
  *
- * @return         void
+ * @return         eError_Ok on success, as for au_pin_threads_core()
  */
 AUD_API_EXPORT
-void
+au_error_t
 au_pin_threads_custom(pthread_t* threadList,
                       size_t     threadListSize,
                       int*       affinityVector,